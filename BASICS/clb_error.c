@@ -332,6 +332,35 @@ double GetTotalCPUTime(void)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: GetChildrenCPUTime()
+//
+//   Return the total CPU time used by all terminated and waited-for
+//   children of the process so far, in floating point seconds - or
+//   -1.0 if this cannot be determined.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double GetChildrenCPUTime(void)
+{
+   double res = -1;
+
+   struct rusage usage;
+
+   if(!getrusage(RUSAGE_CHILDREN, &usage))
+   {
+      res = (usage.ru_utime.tv_sec+usage.ru_stime.tv_sec)+
+         ((usage.ru_utime.tv_usec+usage.ru_stime.tv_usec)/1000000.0);
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: PrintRusage()
@@ -43,6 +43,14 @@ bool MemIsLow = false;
 
 Mem_p free_mem_list[MEM_ARR_SIZE] = {NULL};
 
+#ifdef CLB_MEMORY_COUNT
+/* Allocation counter for benchmarking (blocks recycled from
+   free_mem_list are counted in SizeMallocReal(), all others in
+   SecureMalloc()/SecureRealloc()). */
+
+unsigned long MemAllocCount = 0;
+#endif
+
 #ifdef CLB_MEMORY_DEBUG
 long size_malloc_mem = 0;
 long size_malloc_count = 0;
@@ -152,7 +160,9 @@ void* SecureMalloc(size_t size)
    secure_malloc_count++;
    secure_malloc_mem += size;
 #endif
-
+#ifdef CLB_MEMORY_COUNT
+   MemAllocCount++;
+#endif
    handle = (void*)malloc(size);
 
    if(UNLIKELY(!handle))
@@ -209,6 +219,12 @@ void* SecureRealloc(void *ptr, size_t size)
    {
       secure_realloc_m_count++;
    }
+#endif
+#ifdef CLB_MEMORY_COUNT
+   if(!ptr)
+   {
+      MemAllocCount++;
+   }
 #endif
    /* SunOS realloc() is broken, so here is a stupid workaround...*/
 
@@ -59,6 +59,11 @@ typedef struct memcell
 extern bool MemIsLow;
 extern Mem_p free_mem_list[]; /* Exported for use by inline
                                * functions/Macros */
+#ifdef CLB_MEMORY_COUNT
+extern unsigned long MemAllocCount; /* Blocks handed out by
+                                     * SizeMalloc(), SecureMalloc()
+                                     * and SecureRealloc() */
+#endif
 
 static __inline__ void* SizeMallocReal(size_t size);
 static __inline__ void  SizeFreeReal(void* junk, size_t size);
@@ -170,6 +175,9 @@ static __inline__ void* SizeMallocReal(size_t size)
       assert((free_mem_list[size]->test = MEM_RSET_PATTERN, true));
       handle = free_mem_list[size];
       free_mem_list[size] = free_mem_list[size]->next;
+#ifdef CLB_MEMORY_COUNT
+      MemAllocCount++;
+#endif
    }
    else
    {
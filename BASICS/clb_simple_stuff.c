@@ -169,6 +169,30 @@ int StringIndex(char* key, char* list[])
    return -1;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHash()
+//
+//   Return the (FNV-1a) hash value of str.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+StrHashType StrHash(const char* str)
+{
+   StrHashType hash = STR_HASH_INIT;
+
+   for(; *str; str++)
+   {
+      hash = StrHashStep(hash, *str);
+   }
+   return hash;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: IndentStr()
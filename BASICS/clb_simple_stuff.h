@@ -25,6 +25,7 @@
 #define CLB_SIMPLE_STUFF
 
 #include <string.h>
+#include <stdint.h>
 #include <clb_error.h>
 
 /*---------------------------------------------------------------------*/
@@ -59,6 +60,17 @@ typedef enum
 
 #define MAXINDENTSPACES 72
 
+/* FNV-1a string hashing. StrHashStep() allows incremental hashing
+   (e.g. in the scanner), StrHash() hashes a complete string. The
+   hash is always 64 bits wide, independent of the size of long. */
+
+typedef uint64_t StrHashType;
+
+#define STR_HASH_INIT  UINT64_C(14695981039346656037)
+#define STR_HASH_PRIME UINT64_C(1099511628211)
+#define StrHashStep(hash, ch) \
+   (((StrHashType)(hash)^(unsigned char)(ch))*STR_HASH_PRIME)
+
 #define WeightedObjectArrayAlloc(number)                        \
    SecureMalloc(number * sizeof(WeightedObjectCell))
 #define WeightedObjectArrayFree(array) FREE(array)
@@ -74,6 +86,7 @@ unsigned JKISSRand();
 double   JKISSRandDouble();
 
 int    StringIndex(char* key, char* list[]);
+StrHashType StrHash(const char* str);
 
 char*  IndentStr(int level);
 
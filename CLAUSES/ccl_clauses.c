@@ -987,7 +987,7 @@ bool ClauseIsStronglyRangeRestricted(Clause_p clause)
    vars_stack = PStackAlloc();
    VarBankCollectVars(vars, vars_stack);
 
-   for(i=0; i < vars_stack->size; i++)
+   for(i=0; i < PStackGetSP(vars_stack); i++)
    {
       current_var = PStackElementP(vars_stack, i);
       assert(current_var);
@@ -1003,6 +1003,121 @@ bool ClauseIsStronglyRangeRestricted(Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseLitFeatures()
+//
+//   Return the (cached) literal features of clause, computing them if
+//   they are missing or out of date.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+LitFeatures_p ClauseLitFeatures(Clause_p clause)
+{
+   return LitFeaturesFind(clause, clause->literals);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseLitFeaturesInvalidate()
+//
+//   Mark the cached literal features of clause (if any) as out of
+//   date. Call this whenever literals are modified in place.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void ClauseLitFeaturesInvalidate(Clause_p clause)
+{
+   LitFeaturesForget(clause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseFeatIsRangeRestricted()
+//
+//   As ClauseIsRangeRestricted(), but cache the result in the
+//   literal features of the clause.
+//
+// Global Variables: -
+//
+// Side Effects    : As ClauseIsRangeRestricted(), memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool ClauseFeatIsRangeRestricted(Clause_p clause)
+{
+   LitFeatures_p feats = ClauseLitFeatures(clause);
+
+   if(feats->range_restricted == LF_UNKNOWN)
+   {
+      feats->range_restricted = ClauseIsRangeRestricted(clause);
+   }
+   return feats->range_restricted;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseFeatIsAntiRangeRestricted()
+//
+//   As ClauseIsAntiRangeRestricted(), but cache the result in the
+//   literal features of the clause.
+//
+// Global Variables: -
+//
+// Side Effects    : As ClauseIsAntiRangeRestricted(), memory
+//                   operations
+//
+/----------------------------------------------------------------------*/
+
+bool ClauseFeatIsAntiRangeRestricted(Clause_p clause)
+{
+   LitFeatures_p feats = ClauseLitFeatures(clause);
+
+   if(feats->anti_rr == LF_UNKNOWN)
+   {
+      feats->anti_rr = ClauseIsAntiRangeRestricted(clause);
+   }
+   return feats->anti_rr;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseFeatIsStronglyRangeRestricted()
+//
+//   As ClauseIsStronglyRangeRestricted(), but cache the result in
+//   the literal features of the clause.
+//
+// Global Variables: -
+//
+// Side Effects    : As ClauseIsStronglyRangeRestricted(), memory
+//                   operations
+//
+/----------------------------------------------------------------------*/
+
+bool ClauseFeatIsStronglyRangeRestricted(Clause_p clause)
+{
+   LitFeatures_p feats = ClauseLitFeatures(clause);
+
+   if(feats->strongly_rr == LF_UNKNOWN)
+   {
+      feats->strongly_rr = ClauseIsStronglyRangeRestricted(clause);
+   }
+   return feats->strongly_rr;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseIsEqDefinition()
@@ -1486,16 +1601,16 @@ void ClausePCLPrint(FILE* out, Clause_p clause, bool fullterms)
 
 void ClauseTSTPCorePrint(FILE* out, Clause_p clause, bool fullterms)
 {
-   fputc('(', out);
+   OutPutc('(', out);
    if(ClauseIsEmpty(clause))
    {
-      fprintf(out, "$false");
+      OutPuts(out, "$false");
    }
    else
    {
       EqnListTSTPPrint(out, clause->literals, "|", fullterms);
    }
-   fputc(')', out);
+   OutPutc(')', out);
 }
 
 
@@ -1552,21 +1667,24 @@ void ClauseTSTPPrint(FILE* out, Clause_p clause, bool fullterms, bool complete)
          break;
    }
    source = ClauseQueryCSSCPASource(clause);
+   OutPuts(out, kind);
    if(clause->ident >= 0)
    {
-      fprintf(out, "%s(c_%d_%ld, ",
-              kind,
-              source,
-              clause->ident);
+      OutPuts(out, "(c_");
+      OutPrintLong(out, source);
+      OutPutc('_', out);
+      OutPrintLong(out, clause->ident);
    }
    else
    {
-      fprintf(out, "%s(i_%d_%ld, ",
-              kind,
-              source,
-              clause->ident-LONG_MIN);
+      OutPuts(out, "(i_");
+      OutPrintLong(out, source);
+      OutPutc('_', out);
+      OutPrintLong(out, clause->ident-LONG_MIN);
    }
-   fprintf(out, "%s, ", typename);
+   OutPuts(out, ", ");
+   OutPuts(out, typename);
+   OutPuts(out, ", ");
 
    if(is_untyped)
    {
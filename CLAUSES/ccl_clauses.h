@@ -25,6 +25,7 @@
 #include <ccl_neweval.h>
 #include <ccl_eqnlist.h>
 #include <ccl_clauseinfo.h>
+#include <ccl_litfeatures.h>
 #include <clb_properties.h>
 
 /*---------------------------------------------------------------------*/
@@ -293,6 +294,14 @@ bool     ClauseIsRangeRestricted(Clause_p clause);
 bool     ClauseIsAntiRangeRestricted(Clause_p clause);
 bool     ClauseIsTPTPRangeRestricted(Clause_p clause);
 bool     ClauseIsStronglyRangeRestricted(Clause_p clause);
+
+LitFeatures_p ClauseLitFeatures(Clause_p clause);
+void     ClauseLitFeaturesInvalidate(Clause_p clause);
+bool     ClauseFeatIsRangeRestricted(Clause_p clause);
+bool     ClauseFeatIsAntiRangeRestricted(Clause_p clause);
+bool     ClauseFeatIsStronglyRangeRestricted(Clause_p clause);
+#define  ClauseFeatFindNegPureVarLit(clause)            \
+   LitFeaturesNegPureVarLit(ClauseLitFeatures(clause))
 EqnSide  ClauseIsEqDefinition(Clause_p clause, int min_arity);
 
 Clause_p ClauseCopy(Clause_p clause, TB_p bank);
@@ -0,0 +1,504 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_clausespill.c
+
+  Author: agent
+
+  Contents
+
+  Spilling of clauses to temporary files and reloading them.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  Created: Mon Oct 19 14:21:08 CEST 2026
+  <1> Mon Oct 19 23:58:40 CEST 2026
+      Store everything but the evaluations on disk.
+
+  -----------------------------------------------------------------------*/
+
+#include "ccl_clausespill.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_spillable()
+//
+//   Return true if clause can be written to a spill file and read
+//   back as the same clause. We write plain TSTP CNF, so the clause
+//   must be untyped.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool clause_spillable(Clause_p clause)
+{
+   return ClauseQueryProp(clause, CPDeleteClause) &&
+      ClauseIsUntyped(clause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spill_write()
+//
+//   Write len bytes from data to out, fail on error.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void spill_write(FILE* out, void* data, long len)
+{
+   if(len > 0 && fwrite(data, 1, len, out) != (size_t)len)
+   {
+      SysError("Cannot write spill file", FILE_ERROR);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spill_read()
+//
+//   Read len bytes from in into data, fail on error.
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static void spill_read(FILE* in, void* data, long len)
+{
+   if(len > 0 && fread(data, 1, len, in) != (size_t)len)
+   {
+      Error("Spill file truncated or damaged", FILE_ERROR);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spill_read_string()
+//
+//   Read a string of len bytes from in, return it in a fresh buffer
+//   (NULL if len is -1).
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static char* spill_read_string(FILE* in, long len)
+{
+   char* res;
+
+   if(len < 0)
+   {
+      return NULL;
+   }
+   res = SecureMalloc(len+1);
+   spill_read(in, res, len);
+   res[len] = '\0';
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spill_clause_write()
+//
+//   Append a record for clause to out and note its offset in
+//   key. Moves the evaluations of clause into key.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, changes clause
+//
+/----------------------------------------------------------------------*/
+
+static void spill_clause_write(FILE* out, SpillKey_p key, Clause_p clause)
+{
+   SpillRecordCell record;
+   long            offset, text_start;
+
+   record.properties     = clause->properties;
+   record.create_date    = clause->create_date;
+   record.proof_depth    = clause->proof_depth;
+   record.proof_size     = clause->proof_size;
+   record.has_info       = clause->info != NULL;
+   record.line           = clause->info?clause->info->line:-1;
+   record.column         = clause->info?clause->info->column:-1;
+   record.name_len       = (clause->info && clause->info->name)?
+      (long)strlen(clause->info->name):-1;
+   record.source_len     = (clause->info && clause->info->source)?
+      (long)strlen(clause->info->source):-1;
+   record.derivation_len = clause->derivation?
+      PStackGetSP(clause->derivation):-1;
+   record.text_len       = 0;
+
+   offset = ftell(out);
+   spill_write(out, &record, sizeof(SpillRecordCell));
+   if(record.name_len > 0)
+   {
+      spill_write(out, clause->info->name, record.name_len);
+   }
+   if(record.source_len > 0)
+   {
+      spill_write(out, clause->info->source, record.source_len);
+   }
+   if(record.derivation_len > 0)
+   {
+      spill_write(out, PStackBaseAddress(clause->derivation),
+                  record.derivation_len*sizeof(IntOrP));
+   }
+   text_start = ftell(out);
+   fputs("cnf(s, plain, ", out);
+   ClauseTSTPCorePrint(out, clause, true);
+   fputs(").\n", out);
+   record.text_len = ftell(out)-text_start;
+
+   /* Patch the text length into the record header */
+   if(fseek(out, offset, SEEK_SET) != 0)
+   {
+      SysError("Cannot seek in spill file", FILE_ERROR);
+   }
+   spill_write(out, &record, sizeof(SpillRecordCell));
+   if(fseek(out, 0, SEEK_END) != 0)
+   {
+      SysError("Cannot seek in spill file", FILE_ERROR);
+   }
+
+   key->evaluations    = clause->evaluations;
+   key->offset         = offset;
+   clause->evaluations = NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spill_clause_read()
+//
+//   Read the record described by key from in and return the clause,
+//   with all saved data and the evaluations from key restored.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p spill_clause_read(FILE* in, SpillKey_p key, TB_p bank)
+{
+   SpillRecordCell record;
+   Clause_p        clause;
+   char            *name, *source, *text;
+   PStack_p        derivation = NULL;
+   Scanner_p       scanner;
+
+   if(fseek(in, key->offset, SEEK_SET) != 0)
+   {
+      SysError("Cannot seek in spill file", FILE_ERROR);
+   }
+   spill_read(in, &record, sizeof(SpillRecordCell));
+   name   = spill_read_string(in, record.name_len);
+   source = spill_read_string(in, record.source_len);
+   if(record.derivation_len >= 0)
+   {
+      derivation = PStackVarAlloc(MAX(record.derivation_len, 1));
+      spill_read(in, PStackBaseAddress(derivation),
+                 record.derivation_len*sizeof(IntOrP));
+      derivation->current = record.derivation_len;
+   }
+   text = spill_read_string(in, record.text_len);
+
+   scanner = CreateScanner(StreamTypeInternalString, text, true, NULL);
+   ScannerSetFormat(scanner, TSTPFormat);
+   clause = ClauseParse(scanner, bank);
+   CheckInpTok(scanner, NoToken);
+   DestroyScanner(scanner);
+   FREE(text);
+
+   assert(!clause->evaluations);
+   assert(!clause->derivation);
+
+   ClauseInfoFree(clause->info);
+   clause->info = NULL;
+   if(record.has_info)
+   {
+      clause->info = ClauseInfoAlloc(name, source,
+                                     record.line, record.column);
+   }
+   if(name)
+   {
+      FREE(name);
+   }
+   if(source)
+   {
+      FREE(source);
+   }
+   clause->derivation  = derivation;
+   clause->evaluations = key->evaluations;
+   if(clause->evaluations)
+   {
+      clause->evaluations->object = clause;
+   }
+   key->evaluations    = NULL;
+   clause->properties  = record.properties;
+   ClauseDelProp(clause, CPDeleteClause|CPIsOriented);
+   clause->create_date = record.create_date;
+   clause->proof_depth = record.proof_depth;
+   clause->proof_size  = record.proof_size;
+
+   return clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spill_segment_free()
+//
+//   Free a segment and the evaluations it still owns, and remove its
+//   file.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, removes file
+//
+/----------------------------------------------------------------------*/
+
+static void spill_segment_free(SpillSegment_p junk)
+{
+   long i;
+
+   for(i=0; i<junk->members; i++)
+   {
+      EvalsFree(junk->keys[i].evaluations);
+   }
+   if(junk->keys)
+   {
+      SizeFree(junk->keys, junk->members*sizeof(SpillKeyCell));
+   }
+   TempFileRemove(junk->file);
+   FREE(junk->file);
+   SpillSegmentCellFree(junk);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSpillAlloc()
+//
+//   Allocate an empty spill store.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+ClauseSpill_p ClauseSpillAlloc(void)
+{
+   ClauseSpill_p handle = ClauseSpillCellAlloc();
+
+   handle->segments    = PStackAlloc();
+   handle->spilled     = 0;
+   handle->reloaded    = 0;
+   handle->files       = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSpillFree()
+//
+//   Free a spill store, dropping all clauses still on disk.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, removes files
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSpillFree(ClauseSpill_p junk)
+{
+   while(!PStackEmpty(junk->segments))
+   {
+      spill_segment_free(PStackPopP(junk->segments));
+   }
+   PStackFree(junk->segments);
+   ClauseSpillCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSpillMarkedEntries()
+//
+//   Move all clauses in set that have CPDeleteClause set (and can be
+//   represented in the spill file) into a new segment of spill. Marked
+//   clauses that cannot be spilled stay in the set (and stay
+//   marked). Returns the number of clauses spilled.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes set, writes file, memory operations
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSpillMarkedEntries(ClauseSpill_p spill, ClauseSet_p set)
+{
+   SpillSegment_p segment;
+   Clause_p       handle, clause;
+   FILE*          out;
+   long           count = 0;
+
+   for(handle = set->anchor->succ;
+       handle != set->anchor;
+       handle = handle->succ)
+   {
+      if(clause_spillable(handle))
+      {
+         count++;
+      }
+   }
+   if(!count)
+   {
+      return 0;
+   }
+   segment          = SpillSegmentCellAlloc();
+   segment->file    = TempFileName();
+   segment->members = count;
+   segment->keys    = SizeMalloc(count*sizeof(SpillKeyCell));
+
+   out = OutOpen(segment->file);
+   count = 0;
+   handle = set->anchor->succ;
+   while(handle != set->anchor)
+   {
+      clause = handle;
+      handle = handle->succ;
+
+      if(clause_spillable(clause))
+      {
+         ClauseSetExtractEntry(clause);
+         spill_clause_write(out, &(segment->keys[count]), clause);
+         ClauseFree(clause);
+         count++;
+      }
+   }
+   OutClose(out);
+   assert(count == segment->members);
+
+   PStackPushP(spill->segments, segment);
+   spill->spilled += count;
+   spill->files++;
+
+   return count;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSpillReload()
+//
+//   Read back the most recently spilled segment, restore the saved
+//   keys, and insert the clauses into set (with their old
+//   evaluations). Returns the number of clauses reloaded (0 if there
+//   was nothing to reload).
+//
+// Global Variables: -
+//
+// Side Effects    : Reads and removes file, changes set, memory
+//                   operations
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSpillReload(ClauseSpill_p spill, ClauseSet_p set, TB_p bank)
+{
+   SpillSegment_p segment;
+   FILE*          in;
+   Clause_p       clause;
+   long           i;
+
+   if(ClauseSpillEmpty(spill))
+   {
+      return 0;
+   }
+   segment = PStackPopP(spill->segments);
+
+   in = InputOpen(segment->file, true);
+   for(i=0; i<segment->members; i++)
+   {
+      clause = spill_clause_read(in, &(segment->keys[i]), bank);
+      ClauseSetInsert(set, clause);
+   }
+   InputClose(in);
+   spill->reloaded += i;
+
+   spill_segment_free(segment);
+
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSpillPrintStatistics()
+//
+//   Print the number of spilled and reloaded clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSpillPrintStatistics(FILE* out, ClauseSpill_p spill)
+{
+   fprintf(out, "# Clauses spilled to disk              : %lu\n",
+           spill->spilled);
+   fprintf(out, "# ...in spill files                    : %lu\n",
+           spill->files);
+   fprintf(out, "# ...reloaded                          : %lu\n",
+           spill->reloaded);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,117 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_clausespill.h
+
+  Author: agent
+
+  Contents
+
+  Spilling of (bad) clauses to temporary files. Instead of deleting
+  unprocessed clauses when memory runs low (which makes the prover
+  incomplete), we write them to disk and only keep their evaluations
+  and the position of their record in the spill file in memory.
+  Spilled clauses are read back when the unprocessed set runs dry.
+
+  A spill file is a sequence of records, one per clause. Each record
+  consists of a SpillRecordCell, the name and source of the clause
+  info (if any), the derivation stack (if any) and the clause in
+  plain TSTP CNF syntax. Derivations are stored as the raw stack
+  words. They point to clauses and formulas that stay in memory, so
+  spill files are only meaningful to the process that wrote them.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  Created: Mon Oct 19 14:21:08 CEST 2026
+  <1> Mon Oct 19 23:58:40 CEST 2026
+      Keep only evaluations and file offsets in memory.
+
+  -----------------------------------------------------------------------*/
+
+#ifndef CCL_CLAUSESPILL
+
+#define CCL_CLAUSESPILL
+
+#include <cio_tempfile.h>
+#include <ccl_clausesets.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* What we remember about a clause that lives on disk. */
+
+typedef struct spill_key_cell
+{
+   Eval_p evaluations;
+   long   offset;      /* Of the clause record in the spill file */
+}SpillKeyCell, *SpillKey_p;
+
+
+/* Fixed size part of a clause record in a spill file. Lengths of -1
+   denote missing strings or derivations. */
+
+typedef struct spill_record_cell
+{
+   FormulaProperties properties;
+   long              create_date;
+   long              proof_depth;
+   long              proof_size;
+   bool              has_info;
+   long              line;
+   long              column;
+   long              name_len;
+   long              source_len;
+   long              derivation_len;
+   long              text_len;
+}SpillRecordCell, *SpillRecord_p;
+
+
+/* One spill file. keys[i] belongs to the i-th clause in the file. */
+
+typedef struct spill_segment_cell
+{
+   char*      file;
+   long       members;
+   SpillKey_p keys;
+}SpillSegmentCell, *SpillSegment_p;
+
+
+typedef struct clause_spill_cell
+{
+   PStack_p      segments;    /* Of SpillSegment_p, reloaded LIFO */
+   unsigned long spilled;     /* Clauses written */
+   unsigned long reloaded;    /* Clauses read back */
+   unsigned long files;       /* Segments written */
+}ClauseSpillCell, *ClauseSpill_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define SpillSegmentCellAlloc()    (SpillSegmentCell*)SizeMalloc(sizeof(SpillSegmentCell))
+#define SpillSegmentCellFree(junk) SizeFree(junk, sizeof(SpillSegmentCell))
+#define ClauseSpillCellAlloc()     (ClauseSpillCell*)SizeMalloc(sizeof(ClauseSpillCell))
+#define ClauseSpillCellFree(junk)  SizeFree(junk, sizeof(ClauseSpillCell))
+
+ClauseSpill_p ClauseSpillAlloc(void);
+void          ClauseSpillFree(ClauseSpill_p junk);
+
+#define ClauseSpillEmpty(spill) PStackEmpty((spill)->segments)
+#define ClauseSpillPending(spill) ((spill)->spilled-(spill)->reloaded)
+
+long ClauseSpillMarkedEntries(ClauseSpill_p spill, ClauseSet_p set);
+long ClauseSpillReload(ClauseSpill_p spill, ClauseSet_p set, TB_p bank);
+void ClauseSpillPrintStatistics(FILE* out, ClauseSpill_p spill);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
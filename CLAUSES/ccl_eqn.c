@@ -790,7 +790,7 @@ void EqnPrint(FILE* out, Eqn_p eq, bool negated,  bool fullterms)
 #ifdef MARK_MAX_EQNS
    if(EqnIsMaximal(eq))
    {
-      fprintf(out, "{");
+      OutPutc('{', out);
    }
 #endif
    /* if(EqnIsSelected(eq))
@@ -805,19 +805,19 @@ void EqnPrint(FILE* out, Eqn_p eq, bool negated,  bool fullterms)
    {
       if(positive)
       {
-         fprintf(out,"++");
+         OutPuts(out, "++");
       }
       else
       {
-         fprintf(out,"--");
+         OutPuts(out, "--");
       }
       if(EqnIsEquLit(eq))
       {
-         fputs(EQUAL_PREDICATE"(", out);
+         OutPuts(out, EQUAL_PREDICATE"(");
          TBPrintTerm(out, eq->bank, eq->lterm, fullterms);
-         fprintf(out, ", ");
+         OutPuts(out, ", ");
          TBPrintTerm(out, eq->bank, eq->rterm, fullterms);
-         fputc(')', out);
+         OutPutc(')', out);
       }
       else
       {
@@ -836,27 +836,27 @@ void EqnPrint(FILE* out, Eqn_p eq, bool negated,  bool fullterms)
 
          if(!positive)
          {
-            fputc('!', out);
+            OutPutc('!', out);
          }
          /* fprintf(out, EqnIsOriented(eq)?"=>":"="); */
-         fprintf(out, "=");
+         OutPutc('=', out);
          TBPrintTerm(out, eq->bank, eq->rterm, fullterms);
       }
       else
       {
          if(!positive)
          {
-            fputc('~', out);
+            OutPutc('~', out);
          }
          if((eq->rterm!=eq->bank->true_term) ||
             EqnFullEquationalRep/* ||
                                    eq->lterm==eq->bank->true_term*/)
          {
-            fputs(EQUAL_PREDICATE"(", out);
+            OutPuts(out, EQUAL_PREDICATE"(");
             TBPrintTerm(out, eq->bank, eq->lterm, fullterms);
-            fprintf(out, ", ");
+            OutPuts(out, ", ");
             TBPrintTerm(out, eq->bank, eq->rterm, fullterms);
-            fputc(')', out);
+            OutPutc(')', out);
          }
          else
          {
@@ -867,7 +867,7 @@ void EqnPrint(FILE* out, Eqn_p eq, bool negated,  bool fullterms)
 #ifdef MARK_MAX_EQNS
    if(EqnIsMaximal(eq))
    {
-      fprintf(out, "}");
+      OutPutc('}', out);
    }
 #endif
 }
@@ -887,7 +887,7 @@ void EqnPrint(FILE* out, Eqn_p eq, bool negated,  bool fullterms)
 void EqnPrintDeref(FILE* out, Eqn_p eq, DerefType deref)
 {
    TermPrint(out, eq->lterm, eq->bank->sig, deref);
-   fprintf(out, "%s", EqnIsPositive(eq)?"=":"!=");
+   OutPuts(out, EqnIsPositive(eq)?"=":"!=");
    TermPrint(out, eq->rterm, eq->bank->sig, deref);
 }
 
@@ -932,16 +932,16 @@ void EqnFOFPrint(FILE* out, Eqn_p eq, bool negated,  bool fullterms, bool pcl)
          TBPrintTerm(out, eq->bank, eq->lterm, fullterms);
          if(!positive)
          {
-            fputc('!', out);
+            OutPutc('!', out);
          }
-         fputc('=', out);
+         OutPutc('=', out);
          TBPrintTerm(out, eq->bank, eq->rterm, fullterms);
       }
       else
       {
          if(!positive)
          {
-            fputc('~', out);
+            OutPutc('~', out);
          }
          TBPrintTerm(out, eq->bank, eq->lterm, fullterms);
       }
@@ -950,15 +950,15 @@ void EqnFOFPrint(FILE* out, Eqn_p eq, bool negated,  bool fullterms, bool pcl)
    {
       if(!positive)
       {
-         fprintf(out,"~");
+         OutPutc('~', out);
       }
       if(EqnIsEquLit(eq))
       {
-         fputs(EQUAL_PREDICATE"(", out);
+         OutPuts(out, EQUAL_PREDICATE"(");
          TBPrintTerm(out, eq->bank, eq->lterm, fullterms);
-         fprintf(out, ", ");
+         OutPuts(out, ", ");
          TBPrintTerm(out, eq->bank, eq->rterm, fullterms);
-         fputc(')', out);
+         OutPutc(')', out);
       }
       else
       {
@@ -985,21 +985,21 @@ void EqnTSTPPrint(FILE* out, Eqn_p eq, bool fullterms)
 {
    if(EqnIsPropFalse(eq))
    {
-      fputs("$false", out);
+      OutPuts(out, "$false");
    }
    else
    {
       if(EqnIsEquLit(eq))
       {
          TBPrintTerm(out, eq->bank, eq->lterm, fullterms);
-         fprintf(out, "%s", EqnIsNegative(eq)?"!=":"=");
+         OutPuts(out, EqnIsNegative(eq)?"!=":"=");
          TBPrintTerm(out, eq->bank, eq->rterm, fullterms);
       }
       else
       {
          if(EqnIsNegative(eq))
          {
-            fputc('~', out);
+            OutPutc('~', out);
          }
          TBPrintTerm(out, eq->bank, eq->lterm, fullterms);
       }
@@ -1227,7 +1227,7 @@ void EqnListPrint(FILE* out, Eqn_p list, char* sep,
       while(handle->next)
       {
          handle = handle->next;
-         fputs(sep, out);
+         OutPuts(out, sep);
          EqnPrint(out, handle, negated, fullterms);
       }
    }
@@ -1285,7 +1285,7 @@ void EqnListTSTPPrint(FILE* out, Eqn_p list, char* sep, bool fullterms)
       while(handle->next)
       {
          handle = handle->next;
-         fputs(sep, out);
+         OutPuts(out, sep);
          EqnTSTPPrint(out, handle, fullterms);
       }
    }
@@ -162,6 +162,110 @@ static void check_all_found(Scanner_p in, StrTree_p name_selector)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: include_parse()
+//
+//   Parse the included file read by new_in (if any, NULL means that
+//   it is skipped) with the name selector new_limit, add the result
+//   to fset and wlset, and free new_in and new_limit. Return the
+//   number of elements parsed. Files not yet in the include cache
+//   are added to it (if it is enabled).
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes termbank and sets.
+//
+/----------------------------------------------------------------------*/
+
+static long include_parse(Scanner_p new_in, StrTree_p new_limit,
+                          FormulaSet_p fset, ClauseSet_p wlset,
+                          TB_p terms, StrTree_p *skip_includes)
+{
+   long         res = 0;
+   FormulaSet_p nfset = FormulaSetAlloc();
+   ClauseSet_p  nwlset = ClauseSetAlloc();
+
+   if(new_in)
+   {
+      IncludeCacheRecord(new_in);
+      res = FormulaAndClauseSetParse(new_in,
+                                     nfset,
+                                     nwlset,
+                                     terms,
+                                     &new_limit,
+                                     skip_includes);
+      DestroyScanner(new_in);
+   }
+   StrTreeFree(new_limit);
+   FormulaSetInsertSet(fset, nfset);
+   ClauseSetInsertSet(wlset, nwlset);
+   assert(ClauseSetEmpty(nfset));
+   assert(ClauseSetEmpty(nwlset));
+   FormulaSetFree(nfset);
+   ClauseSetFree(nwlset);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: include_batch_parse()
+//
+//   Read a sequence of consecutive include statements from in,
+//   tokenize the included files in parallel, and parse them (in
+//   order) as include_parse() does. The result is the same as for
+//   reading the includes one by one.
+//
+// Global Variables: IncludePrefetchThreads
+//
+// Side Effects    : Input, changes termbank and sets, uses threads
+//
+/----------------------------------------------------------------------*/
+
+static long include_batch_parse(Scanner_p in, FormulaSet_p fset,
+                                ClauseSet_p wlset, TB_p terms,
+                                StrTree_p *skip_includes)
+{
+   long              res = 0;
+   PStack_p          scanners = PStackAlloc(),
+                     limits = PStackAlloc();
+   StrTree_p         new_limit;
+   IncludePrefetch_p prefetch;
+   PStackPointer     i;
+
+   while(TestInpId(in, "include"))
+   {
+      new_limit = NULL;
+      PStackPushP(scanners,
+                  ScannerParseInclude(in, &new_limit, skip_includes));
+      PStackPushP(limits, new_limit);
+   }
+   if(PStackGetSP(scanners) == 1)
+   {
+      res = include_parse(PStackElementP(scanners, 0),
+                          PStackElementP(limits, 0),
+                          fset, wlset, terms, skip_includes);
+   }
+   else
+   {
+      prefetch = IncludePrefetchStart(scanners, IncludePrefetchThreads);
+      for(i=0; i<PStackGetSP(limits); i++)
+      {
+         res += include_parse(IncludePrefetchGet(prefetch),
+                              PStackElementP(limits, i),
+                              fset, wlset, terms, skip_includes);
+      }
+      IncludePrefetchFree(prefetch);
+   }
+   PStackFree(scanners);
+   PStackFree(limits);
+
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -700,30 +804,21 @@ long FormulaAndClauseSetParse(Scanner_p in, FormulaSet_p fset,
          {
             if(TestInpId(in, "include"))
             {
-               StrTree_p new_limit = NULL;
-               Scanner_p new_in;
-               FormulaSet_p nfset = FormulaSetAlloc();
-               ClauseSet_p  nwlset = ClauseSetAlloc();
-
-               new_in = ScannerParseInclude(in, &new_limit, skip_includes);
-
-               if(new_in)
+               if(IncludePrefetchThreads && ScannerPrefetchable(in))
+               {
+                  res += include_batch_parse(in, fset, wlset, terms,
+                                             skip_includes);
+               }
+               else
                {
-                  res += FormulaAndClauseSetParse(new_in,
-                                                  nfset,
-                                                  nwlset,
-                                                  terms,
-                                                  &new_limit,
-                                                  skip_includes);
-                  DestroyScanner(new_in);
+                  StrTree_p new_limit = NULL;
+                  Scanner_p new_in;
+
+                  new_in = ScannerParseInclude(in, &new_limit,
+                                               skip_includes);
+                  res += include_parse(new_in, new_limit, fset, wlset,
+                                       terms, skip_includes);
                }
-               StrTreeFree(new_limit);
-               FormulaSetInsertSet(fset, nfset);
-               ClauseSetInsertSet(wlset, nwlset);
-               assert(ClauseSetEmpty(nfset));
-               assert(ClauseSetEmpty(nwlset));
-               FormulaSetFree(nfset);
-               ClauseSetFree(nwlset);
             }
             else
             {
@@ -0,0 +1,413 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_litfeatures.c
+
+  Author: agent
+
+  Contents
+
+  Cached per-literal features for literal selection.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  Created: Mon Oct 19 10:12:44 CEST 2026
+
+  -----------------------------------------------------------------------*/
+
+#include "ccl_litfeatures.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* If false, features are recomputed on every request (only useful
+   for measuring the effect of the cache) */
+bool LitFeaturesCaching = true;
+
+/* Statistics */
+long LitFeaturesComputed = 0;
+long LitFeaturesReused   = 0;
+
+/* The direct-mapped feature table, the records for its entries, and
+   the single entry for literal lists too long for the table. */
+static LitFeatures_p features_table = NULL;
+static LitFeature_p  features_store = NULL;
+static LitFeaturesCell long_features;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lit_feature_compute()
+//
+//   Compute the (eager) features of lit and store them in feat.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void lit_feature_compute(LitFeature_p feat, Eqn_p lit)
+{
+   feat->literal    = lit;
+   feat->lterm      = lit->lterm;
+   feat->rterm      = lit->rterm;
+   feat->lweight    = TermStandardWeight(lit->lterm);
+   feat->rweight    = TermStandardWeight(lit->rterm);
+   feat->depth      = LF_UNKNOWN;
+   feat->properties = LFNoProps;
+
+   if(EqnIsPositive(lit))
+   {
+      SetProp(feat, LFIsPositive);
+   }
+   if(EqnIsGround(lit))
+   {
+      SetProp(feat, LFIsGround);
+   }
+   if(EqnIsPureVar(lit))
+   {
+      SetProp(feat, LFIsPureVar);
+   }
+   if(EqnIsTypePred(lit))
+   {
+      SetProp(feat, LFIsTypePred);
+   }
+   if(EqnIsXTypePred(lit))
+   {
+      SetProp(feat, LFIsXTypePred);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lit_feature_check()
+//
+//   Return true if feat still describes lit. If only the sides of the
+//   literal have been swapped (e.g. by orienting it), adapt the
+//   side-dependent features.
+//
+// Global Variables: -
+//
+// Side Effects    : May swap sides in feat.
+//
+/----------------------------------------------------------------------*/
+
+static bool lit_feature_check(LitFeature_p feat, Eqn_p lit)
+{
+   long tmp;
+
+   if(feat->literal != lit ||
+      !QueryProp(feat, LFIsPositive) != !EqnIsPositive(lit))
+   {
+      return false;
+   }
+   if(feat->lterm == lit->lterm && feat->rterm == lit->rterm)
+   {
+      return true;
+   }
+   if(feat->lterm == lit->rterm && feat->rterm == lit->lterm)
+   {
+      feat->lterm   = lit->lterm;
+      feat->rterm   = lit->rterm;
+      tmp           = feat->lweight;
+      feat->lweight = feat->rweight;
+      feat->rweight = tmp;
+      DelProp(feat, LFIsTypePred|LFIsXTypePred|LFRXTypeKnown);
+      if(EqnIsTypePred(lit))
+      {
+         SetProp(feat, LFIsTypePred);
+      }
+      if(EqnIsXTypePred(lit))
+      {
+         SetProp(feat, LFIsXTypePred);
+      }
+      return true;
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lit_features_init()
+//
+//   Allocate and initialize the feature table. This happens once, on
+//   first use. The blocks are never resized or freed during the
+//   run, so they do not change the addresses handed out for other
+//   data.
+//
+// Global Variables: features_table, features_store, long_features
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void lit_features_init(void)
+{
+   long i;
+
+   features_table = SecureMalloc(LIT_FEATURES_CACHE_SIZE*
+                                 sizeof(LitFeaturesCell));
+   features_store = SecureMalloc(LIT_FEATURES_CACHE_SIZE*
+                                 LIT_FEATURES_INLINE*
+                                 sizeof(LitFeatureCell));
+   for(i=0; i<LIT_FEATURES_CACHE_SIZE; i++)
+   {
+      features_table[i].owner  = NULL;
+      features_table[i].lit_no = 0;
+      features_table[i].size   = LIT_FEATURES_INLINE;
+      features_table[i].lits   = &(features_store[i*LIT_FEATURES_INLINE]);
+   }
+   long_features.owner  = NULL;
+   long_features.lit_no = 0;
+   long_features.size   = LIT_FEATURES_LONG;
+   long_features.lits   = SecureMalloc(LIT_FEATURES_LONG*
+                                       sizeof(LitFeatureCell));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lit_features_slot()
+//
+//   Return the table entry for owner.
+//
+// Global Variables: features_table
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static LitFeatures_p lit_features_slot(void* owner)
+{
+   uint64_t key = (uint64_t)(uintptr_t)owner;
+
+   key = (key*UINT64_C(0x9E3779B97F4A7C15))>>40;
+
+   return &(features_table[key&(LIT_FEATURES_CACHE_SIZE-1)]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lit_features_update()
+//
+//   Make sure that feats describes the literals in list. If all
+//   records are still valid, just return false. Otherwise recompute
+//   all features and return true.
+//
+// Global Variables: LitFeaturesCaching, LitFeaturesComputed,
+//                   LitFeaturesReused
+//
+// Side Effects    : May grow long_features
+//
+/----------------------------------------------------------------------*/
+
+static bool lit_features_update(LitFeatures_p feats, Eqn_p list, int len)
+{
+   Eqn_p handle;
+   int   i;
+
+   if(LitFeaturesCaching && len == feats->lit_no)
+   {
+      for(handle = list, i = 0;
+          handle;
+          handle = handle->next, i++)
+      {
+         if(!lit_feature_check(&(feats->lits[i]), handle))
+         {
+            break;
+         }
+      }
+      if(!handle)
+      {
+         LitFeaturesReused++;
+         return false;
+      }
+   }
+   LitFeaturesComputed++;
+
+   if(len > feats->size)
+   {
+      assert(feats == &long_features);
+      while(len > feats->size)
+      {
+         feats->size *= 2;
+      }
+      FREE(feats->lits);
+      feats->lits = SecureMalloc(feats->size*sizeof(LitFeatureCell));
+   }
+   feats->lit_no           = len;
+   feats->neg_pure_var     = -1;
+   feats->range_restricted = LF_UNKNOWN;
+   feats->strongly_rr      = LF_UNKNOWN;
+   feats->anti_rr          = LF_UNKNOWN;
+
+   for(handle = list, i = 0; handle; handle = handle->next, i++)
+   {
+      lit_feature_compute(&(feats->lits[i]), handle);
+      if(feats->neg_pure_var == -1 &&
+         EqnIsNegative(handle) &&
+         LitFeatIsPureVar(&(feats->lits[i])))
+      {
+         feats->neg_pure_var = i;
+      }
+   }
+   return true;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: LitFeaturesFind()
+//
+//   Return an up-to-date feature record for the literal list of
+//   owner. The record is only valid until the next call for a
+//   different owner, and its entry may be taken over by another owner
+//   at any time. Records are validated against the literal list, so a
+//   stale record is never returned.
+//
+// Global Variables: features_table, long_features
+//
+// Side Effects    : Memory operations, may evict another record
+//
+/----------------------------------------------------------------------*/
+
+LitFeatures_p LitFeaturesFind(void* owner, Eqn_p list)
+{
+   LitFeatures_p feats;
+   int           len = EqnListLength(list);
+
+   if(!features_table)
+   {
+      lit_features_init();
+   }
+   feats = (len > LIT_FEATURES_INLINE)?&long_features:
+      lit_features_slot(owner);
+   if(feats->owner != owner)
+   {
+      feats->owner  = owner;
+      feats->lit_no = 0;
+   }
+   lit_features_update(feats, list, len);
+
+   return feats;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LitFeaturesForget()
+//
+//   Drop the record of owner, if any.
+//
+// Global Variables: features_table, long_features
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void LitFeaturesForget(void* owner)
+{
+   LitFeatures_p feats;
+
+   if(!features_table)
+   {
+      return;
+   }
+   feats = lit_features_slot(owner);
+   if(feats->owner == owner)
+   {
+      feats->owner  = NULL;
+      feats->lit_no = 0;
+   }
+   if(long_features.owner == owner)
+   {
+      long_features.owner  = NULL;
+      long_features.lit_no = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LitFeaturesCacheFree()
+//
+//   Release the feature table.
+//
+// Global Variables: features_table, features_store, long_features
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void LitFeaturesCacheFree(void)
+{
+   if(features_table)
+   {
+      FREE(features_table);
+      FREE(features_store);
+      FREE(long_features.lits);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LitFeatIsRealXTypePred()
+//
+//   Return true if the literal described by feat is a real extended
+//   type literal (see EqnIsRealXTypePred()). The result is computed
+//   on first request only.
+//
+// Global Variables: -
+//
+// Side Effects    : Updates feat
+//
+/----------------------------------------------------------------------*/
+
+bool LitFeatIsRealXTypePred(LitFeature_p feat)
+{
+   if(!QueryProp(feat, LFRXTypeKnown))
+   {
+      SetProp(feat, LFRXTypeKnown);
+      if(EqnIsRealXTypePred(feat->literal))
+      {
+         SetProp(feat, LFIsRealXTypePred);
+      }
+      else
+      {
+         DelProp(feat, LFIsRealXTypePred);
+      }
+   }
+   return QueryProp(feat, LFIsRealXTypePred);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
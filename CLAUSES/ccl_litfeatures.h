@@ -0,0 +1,137 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_litfeatures.h
+
+  Author: agent
+
+  Contents
+
+  Cached per-literal features (weights, groundness, depth, type
+  predicate status,...) of a literal list. The literal selection
+  functions consult these many times for the same clause (once when a
+  clause is generated, again when it is selected for processing), so
+  we compute them once and only recompute them if the literals have
+  changed (e.g. by rewriting).
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  Created: Mon Oct 19 10:12:44 CEST 2026
+
+  -----------------------------------------------------------------------*/
+
+#ifndef CCL_LITFEATURES
+
+#define CCL_LITFEATURES
+
+#include <clb_properties.h>
+#include <ccl_eqnlist.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define LF_UNKNOWN -1
+
+typedef enum
+{
+   LFNoProps         =  0,
+   LFIsGround        =  1, /* Both sides ground */
+   LFIsPureVar       =  2, /* X=Y or X!=Y */
+   LFIsTypePred      =  4, /* See EqnIsTypePred() */
+   LFIsXTypePred     =  8, /* See EqnIsXTypePred() */
+   LFRXTypeKnown     = 16, /* LFIsRealXTypePred is up to date */
+   LFIsRealXTypePred = 32, /* See EqnIsRealXTypePred() */
+   LFIsPositive      = 64  /* Sign of the literal at computation
+                              time */
+}LitFeatureProperties;
+
+
+/* Features of a single literal. The terms are remembered so that we
+   can detect if the literal has been changed since the record has
+   been computed. */
+
+typedef struct lit_feature_cell
+{
+   Eqn_p                literal;
+   Term_p               lterm;
+   Term_p               rterm;
+   long                 lweight;    /* TermStandardWeight() */
+   long                 rweight;
+   long                 depth;      /* LF_UNKNOWN until requested */
+   LitFeatureProperties properties;
+}LitFeatureCell, *LitFeature_p;
+
+
+/* Features of a literal list (usually of a clause). lits[] is
+   parallel to the literal list, i.e. lits[i] describes the i-th
+   literal. Clause-level features are computed on demand.
+
+   Records live in a fixed, direct-mapped table indexed by the address
+   of their owner (see LitFeaturesFind()). The table is allocated once
+   and only released at the very end, and the owner (i.e. ClauseCell)
+   is not extended. Proof search in E is sensitive to the addresses of
+   clause and term cells (several indices and sets are ordered by
+   pointer), so changing their size classes or interleaving additional
+   small allocations with them would change the search. */
+
+#define LIT_FEATURES_CACHE_SIZE 4096 /* Entries, must be a power of 2 */
+#define LIT_FEATURES_INLINE     8    /* Literals per table entry */
+#define LIT_FEATURES_LONG       1024 /* Initial literals for the
+                                        single entry for longer
+                                        lists */
+
+typedef struct lit_features_cell
+{
+   void*        owner;            /* Described object, or NULL */
+   int          lit_no;           /* Number of valid records */
+   int          size;             /* Number of allocated records */
+   int          neg_pure_var;     /* Index of first negative X!=Y, or
+                                     -1 */
+   int          range_restricted; /* Tri-state, LF_UNKNOWN until */
+   int          strongly_rr;      /* requested. */
+   int          anti_rr;
+   LitFeature_p lits;
+}LitFeaturesCell, *LitFeatures_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern bool LitFeaturesCaching;
+extern long LitFeaturesComputed;
+extern long LitFeaturesReused;
+
+LitFeatures_p LitFeaturesFind(void* owner, Eqn_p list);
+void          LitFeaturesForget(void* owner);
+void          LitFeaturesCacheFree(void);
+
+#define LitFeatIsGround(feat)    QueryProp((feat), LFIsGround)
+#define LitFeatIsPureVar(feat)   QueryProp((feat), LFIsPureVar)
+#define LitFeatIsTypePred(feat)  QueryProp((feat), LFIsTypePred)
+#define LitFeatIsXTypePred(feat) QueryProp((feat), LFIsXTypePred)
+bool    LitFeatIsRealXTypePred(LitFeature_p feat);
+
+#define LitFeatStandardWeight(feat) ((feat)->lweight+(feat)->rweight)
+#define LitFeatStandardDiff(feat)                              \
+   (MAX((feat)->lweight,(feat)->rweight)-                      \
+    MIN((feat)->lweight,(feat)->rweight))
+#define LitFeatDepth(feat)                                     \
+   ((feat)->depth!=LF_UNKNOWN?(feat)->depth:                   \
+    ((feat)->depth = EqnDepth((feat)->literal)))
+
+#define LitFeaturesNegPureVarLit(feats)                        \
+   ((feats)->neg_pure_var==-1?NULL:                            \
+    (feats)->lits[(feats)->neg_pure_var].literal)
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -181,6 +181,7 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
    handle->has_interpreted_symbols = false;
    handle->definition_store     = DefStoreAlloc(handle->terms);
    handle->def_store_cspec      = NULL;
+   handle->spill_store          = NULL;
 
    handle->gc_terms             = GCAdminAlloc(handle->terms);
    GCRegisterFormulaSet(handle->gc_terms, handle->f_axioms);
@@ -394,6 +395,10 @@ void ProofStateFree(ProofState_p junk)
    ClauseSetFree(junk->processed_neg_units);
    ClauseSetFree(junk->processed_non_units);
    ClauseSetFree(junk->unprocessed);
+   if(junk->spill_store)
+   {
+      ClauseSpillFree(junk->spill_store);
+   }
    ClauseSetFree(junk->schemas);
    ClauseSetFree(junk->tmp_store);
    ClauseSetFree(junk->eval_store);
@@ -594,6 +599,10 @@ void ProofStateStatisticsPrint(FILE* out, ProofState_p state)
            state->other_redundant_count);
    fprintf(out, "# Clauses deleted for lack of memory   : %ld\n",
            state->non_redundant_deleted);
+   if(state->spill_store)
+   {
+      ClauseSpillPrintStatistics(out, state->spill_store);
+   }
    fprintf(out, "# Backward-subsumed                    : %ld\n",
            state->backward_subsumed_count);
    fprintf(out, "# Backward-rewritten                   : %ld\n",
@@ -29,6 +29,7 @@
 #include <ccl_def_handling.h>
 #include <ccl_garbage_coll.h>
 #include <ccl_global_indices.h>
+#include <ccl_clausespill.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -73,6 +74,8 @@ typedef struct proofstatecell
    bool          has_interpreted_symbols;
    DefStore_p    definition_store;
    FVCollect_p   def_store_cspec;
+   ClauseSpill_p spill_store;     /* Unprocessed clauses written to
+                                     disk, NULL if unused */
 
    bool          status_reported;
    long          answer_count;
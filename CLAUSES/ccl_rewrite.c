@@ -1098,6 +1098,7 @@ bool ClauseComputeLINormalform(OCB_p ocb, TB_p bank, Clause_p clause,
    if(res)
    {
       ClauseDelProp(clause, CPInitial);
+      ClauseLitFeaturesInvalidate(clause);
    }
    RWDescCellFree(desc);
 
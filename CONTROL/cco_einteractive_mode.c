@@ -131,6 +131,7 @@ char* run_command(InteractiveSpec_p interactive,
    long wct_limit=30;
    int pid;
 
+   fflush(GlobalOut);
    if ((pid = fork()) == -1)
    {
       return ERR_ERROR_MESSAGE;
@@ -0,0 +1,456 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_perfdb.c
+
+Author: agent
+
+Contents
+
+  Local strategy performance database.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence.
+  See the file COPYING in the main CLIB directory for details.
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 16:02:51 CEST 2026
+    New
+<2> Mon Oct 19 23:59:12 CEST 2026
+    Lock the database while saving.
+
+-----------------------------------------------------------------------*/
+
+#include "cco_perfdb.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_tree_get()
+//
+//   Return the entry for spec_class and strategy in tree, creating an
+//   empty one if necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static StratPerf_p perf_tree_get(StrTree_p *tree, char* spec_class,
+                                 char* strategy)
+{
+   DStr_p      key = DStrAlloc();
+   StrTree_p   cell;
+   StratPerf_p perf;
+   IntOrP      val1, val2;
+
+   DStrAppendStr(key, spec_class);
+   DStrAppendChar(key, ' ');
+   DStrAppendStr(key, strategy);
+
+   cell = StrTreeFind(tree, DStrView(key));
+   if(cell)
+   {
+      perf = cell->val1.p_val;
+   }
+   else
+   {
+      perf = StratPerfCellAlloc();
+      perf->spec_class   = SecureStrdup(spec_class);
+      perf->strategy     = SecureStrdup(strategy);
+      perf->attempts     = 0;
+      perf->successes    = 0;
+      perf->success_time = 0.0;
+      perf->failure_time = 0.0;
+      val1.p_val = perf;
+      val2.i_val = 0;
+      StrTreeStore(tree, DStrView(key), val1, val2);
+   }
+   DStrFree(key);
+   return perf;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_tree_add()
+//
+//   Add the counts in perf to the corresponding entry in tree.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void perf_tree_add(StrTree_p *tree, StratPerf_p perf)
+{
+   StratPerf_p entry = perf_tree_get(tree, perf->spec_class,
+                                     perf->strategy);
+
+   entry->attempts     += perf->attempts;
+   entry->successes    += perf->successes;
+   entry->success_time += perf->success_time;
+   entry->failure_time += perf->failure_time;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_tree_free()
+//
+//   Free a tree of StratPerfCells (including the cells).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void perf_tree_free(StrTree_p tree)
+{
+   PStack_p    stack = StrTreeTraverseInit(tree);
+   StrTree_p   cell;
+   StratPerf_p perf;
+
+   while((cell = StrTreeTraverseNext(stack)))
+   {
+      perf = cell->val1.p_val;
+      FREE(perf->spec_class);
+      FREE(perf->strategy);
+      StratPerfCellFree(perf);
+   }
+   StrTreeTraverseExit(stack);
+   StrTreeFree(tree);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_tree_parse()
+//
+//   Add the entries from the database file to tree. A missing file
+//   is treated as an empty database.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void perf_tree_parse(StrTree_p *tree, char* file)
+{
+   FILE*         test;
+   Scanner_p     in;
+   StratPerfCell perf;
+
+   test = InputOpen(file, false);
+   if(!test)
+   {
+      return;
+   }
+   InputClose(test);
+
+   in = CreateScanner(StreamTypeFile, file, true, NULL);
+   while(!TestInpTok(in, NoToken))
+   {
+      perf.spec_class = DStrCopy(AktToken(in)->literal);
+      AcceptInpTok(in, Identifier);
+      perf.strategy = DStrCopy(AktToken(in)->literal);
+      AcceptInpTok(in, Identifier);
+      perf.attempts     = ParseInt(in);
+      perf.successes    = ParseInt(in);
+      perf.success_time = ParseFloat(in);
+      perf.failure_time = ParseFloat(in);
+      perf_tree_add(tree, &perf);
+      FREE(perf.spec_class);
+      FREE(perf.strategy);
+   }
+   DestroyScanner(in);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_tree_print()
+//
+//   Print all entries of tree in database format.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void perf_tree_print(FILE* out, StrTree_p tree)
+{
+   PStack_p    stack = StrTreeTraverseInit(tree);
+   StrTree_p   cell;
+   StratPerf_p perf;
+
+   fprintf(out, "# E strategy performance database\n"
+           "# class strategy attempts successes success_time "
+           "failure_time\n");
+   while((cell = StrTreeTraverseNext(stack)))
+   {
+      perf = cell->val1.p_val;
+      fprintf(out, "%s %s %ld %ld %.2f %.2f\n",
+              perf->spec_class,
+              perf->strategy,
+              perf->attempts,
+              perf->successes,
+              perf->success_time,
+              perf->failure_time);
+   }
+   StrTreeTraverseExit(stack);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_db_lock()
+//
+//   Take an exclusive lock on the lock file of db (<file>.lock,
+//   created if necessary), waiting for other runs to release it.
+//   Return the file descriptor of the lock file.
+//
+// Global Variables: TmpErrno
+//
+// Side Effects    : Creates file, blocks
+//
+/----------------------------------------------------------------------*/
+
+static int perf_db_lock(PerfDB_p db)
+{
+   DStr_p lockname = DStrAlloc();
+   int    fd;
+
+   DStrAppendStr(lockname, db->file);
+   DStrAppendStr(lockname, ".lock");
+   fd = open(DStrView(lockname), O_RDWR|O_CREAT, 0666);
+   if(fd == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot open lock file %s", FILE_ERROR,
+               DStrView(lockname));
+   }
+   while(flock(fd, LOCK_EX) == -1)
+   {
+      if(errno != EINTR)
+      {
+         TmpErrno = errno;
+         SysError("Cannot lock %s", FILE_ERROR, DStrView(lockname));
+      }
+   }
+   DStrFree(lockname);
+
+   return fd;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: perf_db_unlock()
+//
+//   Release a lock taken with perf_db_lock(). The lock file stays
+//   around, removing it would race with runs waiting for it.
+//
+// Global Variables: -
+//
+// Side Effects    : Releases lock
+//
+/----------------------------------------------------------------------*/
+
+static void perf_db_unlock(int fd)
+{
+   flock(fd, LOCK_UN);
+   close(fd);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfDBAlloc()
+//
+//   Allocate a performance database associated with file and read
+//   the current contents of file (if it exists).
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+PerfDB_p PerfDBAlloc(char* file)
+{
+   PerfDB_p handle = PerfDBCellAlloc();
+
+   handle->file    = SecureStrdup(file);
+   handle->entries = NULL;
+   handle->updates = NULL;
+   perf_tree_parse(&(handle->entries), file);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfDBFree()
+//
+//   Free a performance database (without saving it).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void PerfDBFree(PerfDB_p junk)
+{
+   perf_tree_free(junk->entries);
+   perf_tree_free(junk->updates);
+   FREE(junk->file);
+   PerfDBCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfDBFind()
+//
+//   Return the entry for spec_class and strategy, or NULL if there
+//   is none.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+StratPerf_p PerfDBFind(PerfDB_p db, char* spec_class, char* strategy)
+{
+   DStr_p    key = DStrAlloc();
+   StrTree_p cell;
+
+   DStrAppendStr(key, spec_class);
+   DStrAppendChar(key, ' ');
+   DStrAppendStr(key, strategy);
+   cell = StrTreeFind(&(db->entries), DStrView(key));
+   DStrFree(key);
+
+   return cell?cell->val1.p_val:NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfDBRecord()
+//
+//   Record the result of one attempt of strategy on a problem of
+//   class spec_class.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void PerfDBRecord(PerfDB_p db, char* spec_class, char* strategy,
+                  bool success, double time)
+{
+   StratPerfCell perf;
+
+   perf.spec_class   = spec_class;
+   perf.strategy     = strategy;
+   perf.attempts     = 1;
+   perf.successes    = success?1:0;
+   perf.success_time = success?time:0.0;
+   perf.failure_time = success?0.0:time;
+
+   perf_tree_add(&(db->entries), &perf);
+   perf_tree_add(&(db->updates), &perf);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfDBSave()
+//
+//   Add the results recorded since the last save to the database
+//   file. Under the database lock, the file is re-read, so that
+//   results written by other runs in the meantime are kept, and is
+//   then replaced atomically.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void PerfDBSave(PerfDB_p db)
+{
+   StrTree_p current = NULL, cell;
+   PStack_p  stack;
+   DStr_p    tmpname;
+   FILE*     out;
+   int       lock;
+
+   if(!db->updates)
+   {
+      return;
+   }
+   lock = perf_db_lock(db);
+   perf_tree_parse(&current, db->file);
+   stack = StrTreeTraverseInit(db->updates);
+   while((cell = StrTreeTraverseNext(stack)))
+   {
+      perf_tree_add(&current, cell->val1.p_val);
+   }
+   StrTreeTraverseExit(stack);
+
+   tmpname = DStrAlloc();
+   DStrAppendStr(tmpname, db->file);
+   DStrAppendChar(tmpname, '.');
+   DStrAppendInt(tmpname, getpid());
+   out = OutOpen(DStrView(tmpname));
+   perf_tree_print(out, current);
+   OutClose(out);
+   if(rename(DStrView(tmpname), db->file)!=0)
+   {
+      TmpErrno = errno;
+      SysError("Cannot replace performance database %s", FILE_ERROR,
+               db->file);
+   }
+   perf_db_unlock(lock);
+   DStrFree(tmpname);
+   perf_tree_free(current);
+   perf_tree_free(db->updates);
+   db->updates = NULL;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,96 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_perfdb.h
+
+Author: agent
+
+Contents
+
+  A small local database recording how the strategies of the
+  automatic schedule perform on the problems of this installation,
+  indexed by problem class (as printed by SpecTypePrint()) and
+  strategy name. It is stored as a plain text file with one line
+
+  <class> <strategy> <attempts> <successes> <success_time> <failure_time>
+
+  per entry (times are CPU seconds). Concurrent runs serialize their
+  updates with an flock() on <file>.lock.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence.
+  See the file COPYING in the main CLIB directory for details.
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 16:02:51 CEST 2026
+    New
+<2> Mon Oct 19 23:59:12 CEST 2026
+    Lock the database while saving, rank strategies by success rate
+    per CPU second.
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCO_PERFDB
+
+#define CCO_PERFDB
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <clb_stringtrees.h>
+#include <cio_basicparser.h>
+#include <cio_fileops.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct strat_perf_cell
+{
+   char*  spec_class;
+   char*  strategy;
+   long   attempts;
+   long   successes;
+   double success_time; /* Total CPU time of successful attempts */
+   double failure_time; /* Total CPU time of failed attempts */
+}StratPerfCell, *StratPerf_p;
+
+
+typedef struct perf_db_cell
+{
+   char*     file;
+   StrTree_p entries; /* "class strategy" -> StratPerf_p, file
+                         contents plus the results of this run */
+   StrTree_p updates; /* Results of this run not yet saved */
+}PerfDBCell, *PerfDB_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define StratPerfCellAlloc()    (StratPerfCell*)SizeMalloc(sizeof(StratPerfCell))
+#define StratPerfCellFree(junk) SizeFree(junk, sizeof(StratPerfCell))
+#define PerfDBCellAlloc()       (PerfDBCell*)SizeMalloc(sizeof(PerfDBCell))
+#define PerfDBCellFree(junk)    SizeFree(junk, sizeof(PerfDBCell))
+
+/* Laplace-smoothed success rate, 0.5 for strategies without data */
+#define StratPerfScore(perf) \
+   (((perf)->successes+1.0)/((perf)->attempts+2.0))
+
+/* Total CPU time of all recorded attempts */
+#define StratPerfTime(perf) ((perf)->success_time+(perf)->failure_time)
+
+PerfDB_p    PerfDBAlloc(char* file);
+void        PerfDBFree(PerfDB_p junk);
+StratPerf_p PerfDBFind(PerfDB_p db, char* spec_class, char* strategy);
+void        PerfDBRecord(PerfDB_p db, char* spec_class, char* strategy,
+                         bool success, double time);
+void        PerfDBSave(PerfDB_p db);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
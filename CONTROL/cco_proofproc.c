@@ -1021,6 +1021,41 @@ Clause_p replacing_inferences(ProofState_p state, ProofControl_p
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: spill_target_size()
+//
+//   Return the number of unprocessed clauses to keep when spilling,
+//   so that the storage of the proof state drops to limit. The
+//   storage freed per spilled clause is estimated as the average
+//   storage of an unprocessed clause (shared terms are only freed by
+//   the next garbage collection, if at all). We always spill at
+//   least half of the set, so that the next spill is not due right
+//   after the next given clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long spill_target_size(ProofState_p state, long long limit)
+{
+   long      members = state->unprocessed->members;
+   long long excess, per_clause, needed;
+
+   if(!members)
+   {
+      return 0;
+   }
+   excess     = ProofStateStorage(state)-limit;
+   per_clause = MAX(ClauseSetStorage(state->unprocessed)/members, 1);
+   needed     = (excess+per_clause-1)/per_clause;
+
+   return MAX(MIN(members/2, members-needed), 0);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: cleanup_unprocessed_clauses()
@@ -1030,7 +1065,8 @@ Clause_p replacing_inferences(ProofState_p state, ProofControl_p
 //   - Remove orphaned clauses
 //   - Simplify all unprocessed clauses
 //   - Reweigh all unprocessed clauses
-//   - Delete "bad" clauses to avoid running out of memories.
+//   - Delete (or spill to disk) "bad" clauses to avoid running out
+//     of memory.
 //
 //   Simplification can find the empty clause, which is then
 //   returned.
@@ -1046,7 +1082,7 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
 {
    long long current_storage;
    unsigned long back_simplified;
-   long tmp, tmp2;
+   long tmp, tmp2, spilled;
    long target_size;
    Clause_p unsatisfiable = NULL;
 
@@ -1098,16 +1134,43 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
       ClauseSetReweight(control->hcb,  state->unprocessed);
    }
 
+   if(control->heuristic_parms.spill_bad_clauses && !state->spill_store)
+   {
+      state->spill_store = ClauseSpillAlloc();
+   }
    current_storage  = ProofStateStorage(state);
    if(current_storage > control->heuristic_parms.delete_bad_limit)
    {
       target_size = state->unprocessed->members/2;
       tmp = ClauseSetDeleteOrphans(state->unprocessed);
-      tmp2 = HCBClauseSetDeleteBadClauses(control->hcb,
-                                          state->unprocessed,
-                                          target_size);
+      if(control->heuristic_parms.spill_bad_clauses)
+      {
+         target_size =
+            spill_target_size(state,
+                              control->heuristic_parms.delete_bad_limit);
+         spilled = state->spill_store->spilled;
+         tmp2 = HCBClauseSetSpillBadClauses(control->hcb,
+                                            state->unprocessed,
+                                            target_size,
+                                            state->spill_store);
+         spilled = state->spill_store->spilled - spilled;
+      }
+      else
+      {
+         spilled = 0;
+         tmp2 = HCBClauseSetDeleteBadClauses(control->hcb,
+                                             state->unprocessed,
+                                             target_size);
+      }
       state->non_redundant_deleted += tmp;
-      if(OutputLevel)
+      if(OutputLevel && control->heuristic_parms.spill_bad_clauses)
+      {
+         fprintf(GlobalOut,
+                 "# Deleted %ld orphaned clauses, spilled %ld and "
+                 "deleted %ld bad clauses\n",
+                 tmp, spilled, tmp2);
+      }
+      else if(OutputLevel)
       {
          fprintf(GlobalOut,
                  "# Deleted %ld orphaned clauses and %ld bad "
@@ -1124,6 +1187,60 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
    return unsatisfiable;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: reload_spilled_clauses()
+//
+//   If the unprocessed clause set has run dry, but there are clauses
+//   spilled to disk, read back the most recently spilled batch. Drop
+//   orphans and simplify the rest with the current processed clauses
+//   (which usually have grown since the clauses were spilled). Repeat
+//   until we have at least one unprocessed clause or nothing is left
+//   on disk. Returns the empty clause if found, NULL otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes state->unprocessed, reads and removes
+//                   spill files.
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p reload_spilled_clauses(ProofState_p state,
+                                       ProofControl_p control)
+{
+   long     reloaded, tmp;
+   Clause_p unsatisfiable = NULL;
+
+   while(ClauseSetEmpty(state->unprocessed) &&
+         state->spill_store &&
+         !ClauseSpillEmpty(state->spill_store))
+   {
+      reloaded = ClauseSpillReload(state->spill_store,
+                                   state->unprocessed,
+                                   state->terms);
+      tmp = ClauseSetDeleteOrphans(state->unprocessed);
+      state->other_redundant_count += tmp;
+      unsatisfiable =
+         ForwardContractSet(state, control,
+                            state->unprocessed, false, FullRewrite,
+                            &(state->other_redundant_count), true);
+      if(OutputLevel)
+      {
+         fprintf(GlobalOut,
+                 "# Reloaded %ld spilled clauses, %ld orphaned "
+                 "(remaining: %ld)\n",
+                 reloaded, tmp, state->unprocessed->members);
+      }
+      if(unsatisfiable)
+      {
+         PStackPushP(state->extract_roots, unsatisfiable);
+         break;
+      }
+   }
+   return unsatisfiable;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: SATCheck()
@@ -1290,8 +1407,7 @@ void ProofControlInit(ProofState_p state,ProofControl_p control,
    assert(!control->ocb);
    assert(!control->hcb);
 
-   SpecFeaturesCompute(&(control->problem_specs),
-                       state->axioms,state->signature);
+   ProofControlComputeSpecs(control, state);
 
    control->ocb = TOSelectOrdering(state, params,
                                    &(control->problem_specs));
@@ -1878,6 +1994,11 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
       {
          break;
       }
+      unsatisfiable = reload_spilled_clauses(state, control);
+      if(unsatisfiable)
+      {
+         break;
+      }
       if(control->heuristic_parms.sat_check_grounding != GMNoGrounding)
       {
          if(ProofStateCardinality(state) >= sat_check_size_limit)
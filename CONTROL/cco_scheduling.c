@@ -50,6 +50,113 @@ ScheduleCell StratSchedule[] =
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: schedule_apply_perf_db()
+//
+//   Adapt sched to the local performance data for problems of class
+//   spec_class. Scale the time fraction of each strategy with the
+//   square of its (smoothed) success rate relative to the neutral
+//   0.5, keeping the total constant. Then sort the strategies by
+//   expected successes per CPU second, i.e. the smoothed success rate
+//   divided by the mean CPU time per attempt. The mean time is
+//   smoothed with one extra attempt that takes the average time of
+//   all recorded attempts for the class, and strategies without data
+//   use that average. The sort is stable, so strategies with equal
+//   rates (in particular all strategies without data) keep their
+//   relative order among themselves, while strategies with data
+//   move ahead of or behind them. Return true if there was any data
+//   for the class (otherwise sched is unchanged).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes sched
+//
+/----------------------------------------------------------------------*/
+
+static bool schedule_apply_perf_db(ScheduleCell sched[], PerfDB_p perf_db,
+                                   char* spec_class)
+{
+   int          i, j, n;
+   double       *score, *rate, tmprate;
+   double       old_total = 0.0, new_total = 0.0;
+   double       class_time = 0.0, class_mean;
+   long         class_attempts = 0;
+   ScheduleCell tmp;
+   StratPerf_p  perf, *perfs;
+
+   for(n=0; sched[n].heu_name; n++)
+   {
+      /* Just count */
+   }
+   if(!n)
+   {
+      return false;
+   }
+   perfs = SizeMalloc(n*sizeof(StratPerf_p));
+   for(i=0; i<n; i++)
+   {
+      perfs[i] = PerfDBFind(perf_db, spec_class, sched[i].heu_name);
+      if(perfs[i])
+      {
+         class_attempts += perfs[i]->attempts;
+         class_time     += StratPerfTime(perfs[i]);
+      }
+   }
+   if(!class_attempts)
+   {
+      SizeFree(perfs, n*sizeof(StratPerf_p));
+      return false;
+   }
+   /* Times are rounded to 1/100 s in the file */
+   class_mean = MAX(class_time/class_attempts, 0.01);
+
+   score = SizeMalloc(n*sizeof(double));
+   rate  = SizeMalloc(n*sizeof(double));
+   for(i=0; i<n; i++)
+   {
+      perf     = perfs[i];
+      score[i] = 0.5;
+      rate[i]  = 0.5/class_mean;
+      if(perf)
+      {
+         score[i] = StratPerfScore(perf);
+         rate[i]  = score[i]*(perf->attempts+1.0)/
+            (StratPerfTime(perf)+class_mean);
+      }
+   }
+   for(i=0; i<n; i++)
+   {
+      old_total += sched[i].time_fraction;
+      sched[i].time_fraction *= (2*score[i])*(2*score[i]);
+      new_total += sched[i].time_fraction;
+   }
+   for(i=0; i<n; i++)
+   {
+      if(new_total > 0.0)
+      {
+         sched[i].time_fraction *= old_total/new_total;
+      }
+   }
+   for(i=1; i<n; i++)
+   {
+      tmp     = sched[i];
+      tmprate = rate[i];
+      for(j=i; j>0 && rate[j-1] < tmprate; j--)
+      {
+         sched[j] = sched[j-1];
+         rate[j]  = rate[j-1];
+      }
+      sched[j] = tmp;
+      rate[j]  = tmprate;
+   }
+   SizeFree(rate, n*sizeof(double));
+   SizeFree(score, n*sizeof(double));
+   SizeFree(perfs, n*sizeof(StratPerf_p));
+
+   return true;
+}
+
 
 
 /*---------------------------------------------------------------------*/
@@ -60,19 +167,30 @@ ScheduleCell StratSchedule[] =
 //
 // Function: ScheduleTimesInit()
 //
+//   Compute the absolute time limits for the strategies in sched from
+//   their time fractions and the remaining time. If perf_db is given,
+//   first reorder the strategies and reallocate time according to
+//   the local performance data for problems of class spec_class.
 //
+// Global Variables: ScheduleTimeLimit
 //
-// Global Variables:
-//
-// Side Effects    :
+// Side Effects    : Changes sched
 //
 /----------------------------------------------------------------------*/
 
-void ScheduleTimesInit(ScheduleCell sched[], double time_used)
+void ScheduleTimesInit(ScheduleCell sched[], double time_used,
+                       PerfDB_p perf_db, char* spec_class)
 {
    int i;
    rlim_t sum = 0, tmp, limit;
 
+   if(perf_db && schedule_apply_perf_db(sched, perf_db, spec_class))
+   {
+      fprintf(GlobalOut,
+              "# Schedule adapted to local results for class %s\n",
+              spec_class);
+   }
+
    limit = 0;
    if(ScheduleTimeLimit)
    {
@@ -111,24 +229,30 @@ void ScheduleTimesInit(ScheduleCell sched[], double time_used)
 //
 // Function:  ExecuteSchedule()
 //
-//   Execute the hard-coded strategy schedule.
+//   Execute the hard-coded strategy schedule. If perf_db is given,
+//   use it to adapt the schedule and record the result of each
+//   strategy in it.
 //
 // Global Variables: SilentTimeOut
 //
 // Side Effects    : Forks, the child runs the proof search, re-sets
-//                   time limits, sets heuristic parameters
+//                   time limits, sets heuristic parameters, updates
+//                   perf_db.
 //
 /----------------------------------------------------------------------*/
 
 pid_t ExecuteSchedule(ScheduleCell strats[],
                       HeuristicParms_p  h_parms,
-                      bool print_rusage)
+                      bool print_rusage,
+                      PerfDB_p perf_db,
+                      char* spec_class)
 {
    int raw_status, status = OTHER_ERROR, i;
    pid_t pid       = 0, respid;
-   double run_time = GetTotalCPUTime();
+   double run_time = GetTotalCPUTime(), child_time;
+   bool success;
 
-   ScheduleTimesInit(strats, run_time);
+   ScheduleTimesInit(strats, run_time, perf_db, spec_class);
 
    for(i=0; strats[i].heu_name; i++)
    {
@@ -138,6 +262,7 @@ pid_t ExecuteSchedule(ScheduleCell strats[],
               strats[i].heu_name,
               (long)strats[i].time_absolute);
       fflush(GlobalOut);
+      child_time = GetChildrenCPUTime();
       pid = fork();
       if(pid == 0)
       {
@@ -157,10 +282,22 @@ pid_t ExecuteSchedule(ScheduleCell strats[],
          {
             respid = waitpid(pid, &raw_status, 0);
          }
+         success = WIFEXITED(raw_status) &&
+            ((WEXITSTATUS(raw_status) == SATISFIABLE) ||
+             (WEXITSTATUS(raw_status) == PROOF_FOUND));
+         if(perf_db)
+         {
+            PerfDBRecord(perf_db, spec_class, strats[i].heu_name,
+                         success, GetChildrenCPUTime()-child_time);
+            if(success)
+            {
+               PerfDBSave(perf_db);
+            }
+         }
          if(WIFEXITED(raw_status))
          {
             status = WEXITSTATUS(raw_status);
-            if((status == SATISFIABLE) || (status == PROOF_FOUND))
+            if(success)
             {
                if(print_rusage)
                {
@@ -181,6 +318,10 @@ pid_t ExecuteSchedule(ScheduleCell strats[],
          }
       }
    }
+   if(perf_db)
+   {
+      PerfDBSave(perf_db);
+   }
    if(print_rusage)
    {
       PrintRusage(GlobalOut);
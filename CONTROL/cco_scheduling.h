@@ -29,6 +29,7 @@ Changes
 #include <sys/wait.h>
 #include <cio_signals.h>
 #include <che_hcb.h>
+#include <cco_perfdb.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -52,10 +53,13 @@ typedef struct schedule_cell
 
 extern ScheduleCell StratSchedule[];
 
-void ScheduleTimesInit(ScheduleCell sched[], double time_used);
+void ScheduleTimesInit(ScheduleCell sched[], double time_used,
+                       PerfDB_p perf_db, char* spec_class);
 pid_t ExecuteSchedule(ScheduleCell strats[],
                       HeuristicParms_p  h_parms,
-                      bool print_rusage);
+                      bool print_rusage,
+                      PerfDB_p perf_db,
+                      char* spec_class);
 
 
 #endif
@@ -0,0 +1,29 @@
+% Reload example for --spill-bad-clauses. The storage limit is below
+% what the term bank alone needs, so after every given clause all
+% unprocessed clauses are written to disk, and they are read back
+% when the unprocessed set runs empty. Compare
+%
+%   eprover -s --print-statistics --proof-object spill_reload.p
+%   eprover -s --print-statistics --proof-object --spill-bad-clauses \
+%           --delete-bad-limit=1000 spill_reload.p
+%
+% Both runs should find the same proof after the same number of
+% processed clauses (89). The second run spills and reloads about
+% 20000 clauses. Clauses are picked by the evaluations kept in memory
+% and the proof is built from the derivations stored on disk, so any
+% loss of either shows up as a different search or proof.
+
+cnf(trans, axiom, ~lt(X,Y) | ~lt(Y,Z) | lt(X,Z)).
+cnf(step0, axiom, lt(n0,n1)).
+cnf(step1, axiom, lt(n1,n2)).
+cnf(step2, axiom, lt(n2,n3)).
+cnf(step3, axiom, lt(n3,n4)).
+cnf(step4, axiom, lt(n4,n5)).
+cnf(step5, axiom, lt(n5,n6)).
+cnf(step6, axiom, lt(n6,n7)).
+cnf(step7, axiom, lt(n7,n8)).
+cnf(step8, axiom, lt(n8,n9)).
+cnf(step9, axiom, lt(n9,n10)).
+cnf(step10, axiom, lt(n10,n11)).
+cnf(step11, axiom, lt(n11,n12)).
+cnf(goal, negated_conjecture, ~lt(n0,n12)).
@@ -0,0 +1,17 @@
+% Regression example for ClauseIsStronglyRangeRestricted(). Run as
+%
+%   eprover -s --literal-selection-strategy=SelectNonStrongRROptimalLit \
+%           srr_selection.p
+%
+% E should report "Proof found!". The test used to read past the end
+% of its variable stack, which aborts (with assertions) or reads junk
+% (without).
+
+cnf(c1, axiom, ~p(X) | q(X)).
+cnf(c2, axiom, p(a)).
+cnf(c3, axiom, ~q(X) | ~r(X,Y) | s(Y)).
+cnf(c4, axiom, r(a,b)).
+cnf(c5, axiom, ~s(X) | t(X,Z) | ~u(Z)).
+cnf(c6, axiom, u(c)).
+cnf(c7, negated_conjecture, ~t(b,c)).
+cnf(c8, negated_conjecture, ~s(b) | t(b,c)).
@@ -535,28 +535,27 @@ double ClauseSetNonGoundAxiomPart(ClauseSet_p set)
 
 /*-----------------------------------------------------------------------
 //
-// Function: ClauseSetCollectArityInformation()
+// Function: arity_info_from_dist()
 //
-//   Collect information about the arities of function and predicate
-//   symbol arities. Average and sum for function symbols does not
-//   include constants, it does for predicate symbols. Equality is not
-//   counted, Returns number of function symbol constants.
+//   Compute the arity information for ClauseSetCollectArityInformation()
+//   from a symbol distribution array. Returns number of function
+//   symbol constants.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations
+// Side Effects    : -
 //
 /----------------------------------------------------------------------*/
 
-long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
-                                      int *max_fun_arity,
-                                      int *avg_fun_arity,
-                                      int *sum_fun_arity,
-                                      int *max_pred_arity,
-                                      int *avg_pred_arity,
-                                      int *sum_pred_arity,
-                                      int *non_const_funs,
-                                      int *non_const_preds)
+static long arity_info_from_dist(Sig_p sig, long *dist_array,
+                                 int *max_fun_arity,
+                                 int *avg_fun_arity,
+                                 int *sum_fun_arity,
+                                 int *max_pred_arity,
+                                 int *avg_pred_arity,
+                                 int *sum_pred_arity,
+                                 int *non_const_funs,
+                                 int *non_const_preds)
 {
    int max_f_arity = 0,
       sum_f_arity = 0,
@@ -566,16 +565,8 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
    int max_p_arity = 0,
       sum_p_arity = 0,
       p_count = 0;
-   long  array_size = sizeof(long)*(sig->f_count+1);
-   long *dist_array = SizeMalloc(array_size);
    FunCode i;
 
-   for(i=1; i<= sig->f_count; i++)
-   {
-      dist_array[i] = 0;
-   }
-   ClauseSetAddSymbolDistribution(set, dist_array);
-
    for(i=1; i<= sig->f_count; i++)
    {
       if(!SigIsSpecial(sig, i)&&dist_array[i])
@@ -606,7 +597,6 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
          }
       }
    }
-   SizeFree(dist_array, array_size);
 
    *max_fun_arity   = max_f_arity;
    *avg_fun_arity   = f_count?sum_f_arity/f_count:0;
@@ -621,6 +611,53 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetCollectArityInformation()
+//
+//   Collect information about the arities of function and predicate
+//   symbol arities. Average and sum for function symbols does not
+//   include constants, it does for predicate symbols. Equality is not
+//   counted, Returns number of function symbol constants.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
+                                      int *max_fun_arity,
+                                      int *avg_fun_arity,
+                                      int *sum_fun_arity,
+                                      int *max_pred_arity,
+                                      int *avg_pred_arity,
+                                      int *sum_pred_arity,
+                                      int *non_const_funs,
+                                      int *non_const_preds)
+{
+   long  array_size = sizeof(long)*(sig->f_count+1);
+   long *dist_array = SizeMalloc(array_size);
+   long  res;
+   FunCode i;
+
+   for(i=1; i<= sig->f_count; i++)
+   {
+      dist_array[i] = 0;
+   }
+   ClauseSetAddSymbolDistribution(set, dist_array);
+
+   res = arity_info_from_dist(sig, dist_array,
+                              max_fun_arity, avg_fun_arity,
+                              sum_fun_arity, max_pred_arity,
+                              avg_pred_arity, sum_pred_arity,
+                              non_const_funs, non_const_preds);
+   SizeFree(dist_array, array_size);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetCountMaximalTerms()
@@ -887,59 +924,91 @@ long ClauseSetMaxLiteralNumber(ClauseSet_p set)
 //
 // Function: SpecFeaturesCompute()
 //
-//   Compute all relevant features for a set of clauses.
+//   Compute all relevant features for a set of clauses. This is
+//   equivalent to calling the individual ClauseSetCountX() functions
+//   above, but traverses the clause set only once.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
 void SpecFeaturesCompute(SpecFeature_p features, ClauseSet_p set,
                          Sig_p sig)
 {
-   long tmp, count;
-
-   features->clauses          = set->members;
-   features->goals            = ClauseSetCountGoals(set);
-   features->axioms           = features->clauses-features->goals;
+   long     depthsum = 0, count = 0;
+   long     array_size = sizeof(long)*(sig->f_count+1);
+   long     *dist_array = SizeMalloc(array_size);
+   Clause_p handle;
+   bool     goal, unit, horn, ground;
+   FunCode  i;
 
-   features->literals         = set->literals;
-   features->term_cells       = ClauseSetTermCells(set);
+   for(i=1; i<= sig->f_count; i++)
+   {
+      dist_array[i] = 0;
+   }
+   features->clauses              = set->members;
+   features->literals             = set->literals;
+   features->goals                = 0;
+   features->term_cells           = 0;
+   features->clause_max_depth     = 0;
+   features->unit                 = 0;
+   features->unitgoals            = 0;
+   features->horn                 = 0;
+   features->horngoals            = 0;
+   features->eq_clauses           = 0;
+   features->peq_clauses          = 0;
+   features->groundunitaxioms     = 0;
+   features->groundgoals          = 0;
+   features->positiveaxioms       = 0;
+   features->groundpositiveaxioms = 0;
 
-   tmp = 0;
-   count = 0;
-   features->clause_max_depth = 0;
-   ClauseSetTPTPDepthInfoAdd(set,
+   for(handle = set->anchor->succ; handle!=set->anchor; handle =
+          handle->succ)
+   {
+      goal   = ClauseIsGoal(handle);
+      unit   = ClauseIsUnit(handle);
+      horn   = ClauseIsHorn(handle);
+      ground = ClauseIsGround(handle);
+
+      features->goals       += goal;
+      features->unit        += unit;
+      features->unitgoals   += (unit && goal);
+      features->horn        += horn;
+      features->horngoals   += (horn && goal);
+      features->groundgoals += (goal && ground);
+      features->eq_clauses  += ClauseIsEquational(handle);
+      features->peq_clauses += ClauseIsPureEquational(handle);
+      features->groundunitaxioms += (ClauseIsDemodulator(handle) && ground);
+      if(ClauseIsPositive(handle))
+      {
+         features->positiveaxioms++;
+         features->groundpositiveaxioms += ground;
+      }
+      features->term_cells += ClauseWeight(handle, 1, 1, 1, 1, 1, false);
+      ClauseTPTPDepthInfoAdd(handle,
                              &(features->clause_max_depth),
-                             &tmp,
+                             &depthsum,
                              &count);
-   features->clause_avg_depth = count?tmp/count:0;
-
-   features->unit             = ClauseSetCountUnit(set);
-   features->unitgoals        = ClauseSetCountUnitGoals(set);
+      ClauseAddSymbolDistribution(handle, dist_array);
+   }
+   features->axioms           = features->clauses-features->goals;
+   features->clause_avg_depth = count?depthsum/count:0;
    features->unitaxioms       = features->unit-features->unitgoals;
-
-   features->horn             = ClauseSetCountHorn(set);
-   features->horngoals        = ClauseSetCountHornGoals(set);
    features->hornaxioms       = features->horn-features->horngoals;
 
-   features->eq_clauses       = ClauseSetCountEquational(set);
-   features->peq_clauses      = ClauseSetCountPureEquational(set);
-   features->groundunitaxioms = ClauseSetCountGroundUnitAxioms(set);
-   features->groundgoals      = ClauseSetCountGroundGoals(set);
-   features->positiveaxioms   = ClauseSetCountPositiveAxioms(set);
-   features->groundpositiveaxioms = ClauseSetCountGroundPositiveAxioms(set);
-   features->fun_const_count   =
-      ClauseSetCollectArityInformation(set, sig,
-                                       &(features->max_fun_arity),
-                                       &(features->avg_fun_arity),
-                                       &(features->sum_fun_arity),
-                                       &(features->max_pred_arity),
-                                       &(features->avg_pred_arity),
-                                       &(features->sum_pred_arity),
-                                       &(features->fun_nonconst_count),
-                                       &(features->pred_nonconst_count));
+   features->fun_const_count  =
+      arity_info_from_dist(sig, dist_array,
+                           &(features->max_fun_arity),
+                           &(features->avg_fun_arity),
+                           &(features->sum_fun_arity),
+                           &(features->max_pred_arity),
+                           &(features->avg_pred_arity),
+                           &(features->sum_pred_arity),
+                           &(features->fun_nonconst_count),
+                           &(features->pred_nonconst_count));
+   SizeFree(dist_array, array_size);
 
    features->goals_are_ground = (features->groundgoals ==
                                  features->goals);
@@ -1393,9 +1462,10 @@ void SpecFeaturesParse(Scanner_p in, SpecFeature_p features)
 
 /*-----------------------------------------------------------------------
 //
-// Function: SpecTypePrint()
+// Function: SpecTypeString()
 //
-//   Print the type of the problem as a n-letter code.
+//   Write the type of the problem as a n-letter code into result
+//   (which must have space for SPEC_TYPE_LEN+1 characters).
 //   1) Axioms are [U]nit, [H]orn, [General]
 //   2) Goals  are [U]nit, [H]orn, [General]
 //   3) [N]o equality, [S]ome equality, [P]ure equality
@@ -1408,14 +1478,13 @@ void SpecFeaturesParse(Scanner_p in, SpecFeature_p features)
 //
 /----------------------------------------------------------------------*/
 
-void SpecTypePrint(FILE* out, SpecFeature_p features, char* mask)
+void SpecTypeString(char* result, SpecFeature_p features, char* mask)
 {
    const char encoding[]="UHGNSPFSMFSMFSMFSMSML0123SMLSMD";
-   char       result[14]; /* Big enough for the '\0'!!!*/
    int        i, limit;
 
    assert(features);
-   assert(mask && (strlen(mask)==13));
+   assert(mask && (strlen(mask)==SPEC_TYPE_LEN));
    limit = strlen(mask);
 
    sprintf(result, "%c%c%c%c%c%c%c%c%c%c%c%c%c",
@@ -1439,6 +1508,27 @@ void SpecTypePrint(FILE* out, SpecFeature_p features, char* mask)
          result[i]= '-';
       }
    }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecTypePrint()
+//
+//   Print the type of the problem as a n-letter code (see
+//   SpecTypeString()).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void SpecTypePrint(FILE* out, SpecFeature_p features, char* mask)
+{
+   char result[SPEC_TYPE_LEN+1];
+
+   SpecTypeString(result, features, mask);
    fputs(result, out);
 }
 
@@ -198,6 +198,7 @@ typedef struct spec_feature_cell
 
 #define DEFAULT_OUTPUT_DESCRIPTOR "eigEIG"
 #define DEFAULT_CLASS_MASK "aaaaaaaaaaaaa"
+#define SPEC_TYPE_LEN      13 /* Length of class codes and masks */
 
 
 #define SpecLimitsCellAlloc() \
@@ -382,6 +383,7 @@ void    SpecFeaturesPrint(FILE* out, SpecFeature_p features);
 
 void    SpecFeaturesParse(Scanner_p in, SpecFeature_p features);
 
+void    SpecTypeString(char* result, SpecFeature_p features, char* mask);
 void    SpecTypePrint(FILE* out, SpecFeature_p features, char* mask);
 
 void    ClauseSetPrintPosUnits(FILE* out, ClauseSet_p set, bool
@@ -154,6 +154,7 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->filter_orphans_limit          = DEFAULT_FILTER_ORPHANS_LIMIT;
    handle->forward_contract_limit        = DEFAULT_FORWARD_CONTRACT_LIMIT;
    handle->delete_bad_limit              = DEFAULT_DELETE_BAD_LIMIT;
+   handle->spill_bad_clauses             = false;
    handle->mem_limit                     = 0;
    handle->watchlist_simplify            = true;
    handle->watchlist_is_static           = false;
@@ -489,6 +490,34 @@ long HCBClauseSetDeleteBadClauses(HCB_p hcb, ClauseSet_p set, long
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: HCBClauseSetSpillBadClauses()
+//
+//   Move all but the best number clauses from the set into the spill
+//   store. Clauses that cannot be spilled are deleted. Returns the
+//   number of deleted (not spilled) clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes set, writes spill file.
+//
+/----------------------------------------------------------------------*/
+
+long HCBClauseSetSpillBadClauses(HCB_p hcb, ClauseSet_p set, long
+                                 number, ClauseSpill_p spill)
+{
+   long res;
+
+   ClauseSetSetProp(set, CPDeleteClause);
+   HCBClauseSetDelProp(hcb, set, number, CPDeleteClause);
+   ClauseSpillMarkedEntries(spill, set);
+   res = ClauseSetDeleteMarkedEntries(set);
+
+   return res;
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
@@ -33,6 +33,7 @@
 #include <che_to_weightgen.h>
 #include <che_to_precgen.h>
 #include <ccl_clausefunc.h>
+#include <ccl_clausespill.h>
 #include <che_wfcbadmin.h>
 #include <che_litselection.h>
 
@@ -132,6 +133,7 @@ typedef struct heuristic_parms_cell
    long                filter_orphans_limit;
    long                forward_contract_limit;
    long long           delete_bad_limit;
+   bool                spill_bad_clauses;
    rlim_t              mem_limit;
    bool                watchlist_simplify;
    bool                watchlist_is_static;
@@ -226,6 +228,8 @@ long     HCBClauseSetDelProp(HCB_p hcb, ClauseSet_p set, long number,
                              FormulaProperties prop);
 long HCBClauseSetDeleteBadClauses(HCB_p hcb, ClauseSet_p set, long
                                   number);
+long HCBClauseSetSpillBadClauses(HCB_p hcb, ClauseSet_p set, long
+                                 number, ClauseSpill_p spill);
 
 #endif
 
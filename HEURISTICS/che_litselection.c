@@ -201,6 +201,61 @@ static long literal_weight_counter=0;
 #define lit_sel_diff_weight(handle) \
         ((100*EqnStandardDiff(handle))+EqnStandardWeight(handle))
 
+/* Per-literal and per-clause properties used by the selection
+   functions. Normally they are read from the literal feature cache
+   (see ccl_litfeatures.h), walking the feature records in parallel
+   with the literals. With LITSEL_NO_FEATURES, the "feature" of a
+   literal is the literal itself and everything is computed from it
+   directly, as before the cache was introduced. eheurbench builds
+   that variant as a reference. */
+
+#ifdef LITSEL_NO_FEATURES
+typedef Eqn_p SelFeat_p;
+#define SEL_FEATURES(clause)         ((clause)->literals)
+#define SEL_NEXT(feat)               ((feat) = (feat)->next)
+#define SEL_LIT_FEAT(feat)           NULL
+#define SEL_EVAL_FEAT(lit)           ((lit)->literal)
+#define SelFeatIsGround(feat)        EqnIsGround(feat)
+#define SelFeatIsPureVar(feat)       EqnIsPureVar(feat)
+#define SelFeatIsTypePred(feat)      EqnIsTypePred(feat)
+#define SelFeatIsXTypePred(feat)     EqnIsXTypePred(feat)
+#define SelFeatIsRealXTypePred(feat) EqnIsRealXTypePred(feat)
+#define SelFeatStandardWeight(feat)  EqnStandardWeight(feat)
+#define SelFeatDepth(feat)           EqnDepth(feat)
+#define sel_diff_weight(feat)        lit_sel_diff_weight(feat)
+#define SelClauseIsRangeRestricted(clause)         \
+   ClauseIsRangeRestricted(clause)
+#define SelClauseIsAntiRangeRestricted(clause)     \
+   ClauseIsAntiRangeRestricted(clause)
+#define SelClauseIsStronglyRangeRestricted(clause) \
+   ClauseIsStronglyRangeRestricted(clause)
+#define SelClauseFindNegPureVarLit(clause)         \
+   ClauseFindNegPureVarLit(clause)
+#else
+typedef LitFeature_p SelFeat_p;
+#define SEL_FEATURES(clause)         (ClauseLitFeatures(clause)->lits)
+#define SEL_NEXT(feat)               ((feat)++)
+#define SEL_LIT_FEAT(feat)           (feat)
+#define SEL_EVAL_FEAT(lit)           ((lit)->feat)
+#define SelFeatIsGround(feat)        LitFeatIsGround(feat)
+#define SelFeatIsPureVar(feat)       LitFeatIsPureVar(feat)
+#define SelFeatIsTypePred(feat)      LitFeatIsTypePred(feat)
+#define SelFeatIsXTypePred(feat)     LitFeatIsXTypePred(feat)
+#define SelFeatIsRealXTypePred(feat) LitFeatIsRealXTypePred(feat)
+#define SelFeatStandardWeight(feat)  LitFeatStandardWeight(feat)
+#define SelFeatDepth(feat)           LitFeatDepth(feat)
+#define sel_diff_weight(feat) \
+        ((100*LitFeatStandardDiff(feat))+LitFeatStandardWeight(feat))
+#define SelClauseIsRangeRestricted(clause)         \
+   ClauseFeatIsRangeRestricted(clause)
+#define SelClauseIsAntiRangeRestricted(clause)     \
+   ClauseFeatIsAntiRangeRestricted(clause)
+#define SelClauseIsStronglyRangeRestricted(clause) \
+   ClauseFeatIsStronglyRangeRestricted(clause)
+#define SelClauseFindNegPureVarLit(clause)         \
+   ClauseFeatFindNegPureVarLit(clause)
+#endif
+
 /*-----------------------------------------------------------------------
 //
 // Function: find_maxlcomplex_literal()
@@ -217,6 +272,7 @@ static long literal_weight_counter=0;
 static Eqn_p find_maxlcomplex_literal(Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
+   SelFeat_p lits = SEL_FEATURES(clause), feat = lits;
    long select_weight, weight;
 
    while(handle)
@@ -230,6 +286,7 @@ static Eqn_p find_maxlcomplex_literal(Clause_p clause)
     break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(selected)
    {
@@ -237,13 +294,14 @@ static Eqn_p find_maxlcomplex_literal(Clause_p clause)
    }
    select_weight = -1;
    handle = clause->literals;
+   feat = lits;
 
    while(handle)
    {
       if(EqnIsNegative(handle) && EqnIsMaximal(handle)&&
-    EqnIsGround(handle))
+    SelFeatIsGround(feat))
       {
-    weight = lit_sel_diff_weight(handle);
+    weight = sel_diff_weight(feat);
     if(weight > select_weight)
     {
        select_weight = weight;
@@ -251,6 +309,7 @@ static Eqn_p find_maxlcomplex_literal(Clause_p clause)
          }
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(selected)
    {
@@ -258,12 +317,13 @@ static Eqn_p find_maxlcomplex_literal(Clause_p clause)
    }
    select_weight = -1;
    handle = clause->literals;
+   feat = lits;
 
    while(handle)
    {
       if(EqnIsNegative(handle) && EqnIsMaximal(handle))
       {
-    weight = lit_sel_diff_weight(handle);
+    weight = sel_diff_weight(feat);
     if(weight > select_weight)
     {
        select_weight = weight;
@@ -271,6 +331,7 @@ static Eqn_p find_maxlcomplex_literal(Clause_p clause)
     }
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    return selected;
 }
@@ -292,6 +353,7 @@ static Eqn_p find_maxlcomplex_literal(Clause_p clause)
 static Eqn_p find_lcomplex_literal(Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
+   SelFeat_p lits = SEL_FEATURES(clause), feat = lits;
    long select_weight, weight;
 
    while(handle)
@@ -305,6 +367,7 @@ static Eqn_p find_lcomplex_literal(Clause_p clause)
     break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(selected)
    {
@@ -313,12 +376,13 @@ static Eqn_p find_lcomplex_literal(Clause_p clause)
 
    select_weight = -1;
    handle = clause->literals;
+   feat = lits;
 
    while(handle)
    {
-      if(EqnIsNegative(handle)&&!EqnIsMaximal(handle)&&EqnIsGround(handle))
+      if(EqnIsNegative(handle)&&!EqnIsMaximal(handle)&&SelFeatIsGround(feat))
       {
-    weight = lit_sel_diff_weight(handle);
+    weight = sel_diff_weight(feat);
     if(weight > select_weight)
     {
        select_weight = weight;
@@ -326,6 +390,7 @@ static Eqn_p find_lcomplex_literal(Clause_p clause)
     }
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(selected)
    {
@@ -334,12 +399,13 @@ static Eqn_p find_lcomplex_literal(Clause_p clause)
 
    select_weight = -1;
    handle = clause->literals;
+   feat = lits;
 
    while(handle)
    {
       if(EqnIsNegative(handle)&&!EqnIsMaximal(handle))
       {
-    weight = lit_sel_diff_weight(handle);
+    weight = sel_diff_weight(feat);
     if(weight > select_weight)
     {
        select_weight = weight;
@@ -347,6 +413,7 @@ static Eqn_p find_lcomplex_literal(Clause_p clause)
     }
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    return selected;
 }
@@ -369,22 +436,24 @@ static Eqn_p find_lcomplex_literal(Clause_p clause)
 static Eqn_p find_smallest_neg_ground_lit(Clause_p clause)
 {
    Eqn_p handle = clause->literals, selected = NULL;
+   SelFeat_p feat = SEL_FEATURES(clause);
    long select_weight = LONG_MAX;
 
    while(handle)
    {
       if(EqnIsNegative(handle)&&
-    EqnIsGround(handle))
+    SelFeatIsGround(feat))
       {
     assert(EqnIsOriented(handle));
 
-    if(EqnStandardWeight(handle) < select_weight)
+    if(SelFeatStandardWeight(feat) < select_weight)
     {
        selected = handle;
-       select_weight = EqnStandardWeight(handle);
+       select_weight = SelFeatStandardWeight(feat);
     }
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    return selected;
 }
@@ -598,6 +667,7 @@ void generic_uniq_selection(OCB_p ocb, Clause_p clause, bool positive,
 {
    int       len  = ClauseLiteralNumber(clause);
    LitEval_p lits, tmp;
+   SelFeat_p feat;
    int i, cand;
    Eqn_p handle;
    bool selected = false;
@@ -612,9 +682,12 @@ void generic_uniq_selection(OCB_p ocb, Clause_p clause, bool positive,
    {
       ClauseCondMarkMaximalTerms(ocb, clause);
    }
+   feat = SEL_FEATURES(clause);
    for(handle=clause->literals, i=0; handle; handle=handle->next,i++)
    {
       lits[i].literal = handle;
+      lits[i].feat    = SEL_LIT_FEAT(feat);
+      SEL_NEXT(feat);
       tmp = &(lits[i]);
       LitEvalInit(tmp);
       assert(clause);
@@ -773,6 +846,26 @@ void LitSelAppendNames(DStr_p str)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: LitSelResetCounter()
+//
+//   Reset the counter the diversification selection functions use as
+//   a pseudo-random source, so that their results can be reproduced
+//   (e.g. to compare implementations).
+//
+// Global Variables: literal_weight_counter
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void LitSelResetCounter(void)
+{
+   literal_weight_counter = 0;
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -877,7 +970,7 @@ void PSelectNegativeLiterals(OCB_p ocb, Clause_p clause)
 
 void SelectFirstVariableLiteral(OCB_p ocb, Clause_p clause)
 {
-   Eqn_p handle = ClauseFindNegPureVarLit(clause);
+   Eqn_p handle = SelClauseFindNegPureVarLit(clause);
 
    if(handle)
    {
@@ -901,7 +994,7 @@ void SelectFirstVariableLiteral(OCB_p ocb, Clause_p clause)
 
 void PSelectFirstVariableLiteral(OCB_p ocb, Clause_p clause)
 {
-   Eqn_p handle = ClauseFindNegPureVarLit(clause);
+   Eqn_p handle = SelClauseFindNegPureVarLit(clause);
 
    if(handle)
    {
@@ -1843,12 +1936,13 @@ void SelectMinOptimalNoRXTypePred(OCB_p ocb, Clause_p clause)
    if(!selected)
    {
       Eqn_p handle = clause->literals;
+      SelFeat_p feat = SEL_FEATURES(clause);
       long select_weight = LONG_MAX, weight;
       while(handle)
       {
-         if(EqnIsNegative(handle) && !EqnIsRealXTypePred(handle))
+         if(EqnIsNegative(handle) && !SelFeatIsRealXTypePred(feat))
          {
-            weight = EqnStandardWeight(handle);
+            weight = SelFeatStandardWeight(feat);
             if(weight < select_weight)
             {
                select_weight = weight;
@@ -1856,6 +1950,7 @@ void SelectMinOptimalNoRXTypePred(OCB_p ocb, Clause_p clause)
             }
          }
          handle = handle->next;
+         SEL_NEXT(feat);
       }
    }
    if(selected)
@@ -1890,12 +1985,13 @@ void PSelectMinOptimalNoRXTypePred(OCB_p ocb, Clause_p clause)
    if(!selected)
    {
       Eqn_p handle = clause->literals;
+      SelFeat_p feat = SEL_FEATURES(clause);
       long select_weight = LONG_MAX, weight;
       while(handle)
       {
-         if(EqnIsNegative(handle) && !EqnIsRealXTypePred(handle))
+         if(EqnIsNegative(handle) && !SelFeatIsRealXTypePred(feat))
          {
-            weight = EqnStandardWeight(handle);
+            weight = SelFeatStandardWeight(feat);
             if(weight < select_weight)
             {
                select_weight = weight;
@@ -1903,6 +1999,7 @@ void PSelectMinOptimalNoRXTypePred(OCB_p ocb, Clause_p clause)
             }
          }
          handle = handle->next;
+         SEL_NEXT(feat);
       }
    }
    if(selected)
@@ -2130,16 +2227,18 @@ void PSelectAllCondOptimalLiteral(OCB_p ocb, Clause_p clause)
 void SelectDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals;
+   SelFeat_p feat = SEL_FEATURES(clause);
    bool found = false;
 
    while(handle)
    {
-      if(EqnDepth(handle)<=2)
+      if(SelFeatDepth(feat)<=2)
       {
          found = true;
          break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(!found)
    {
@@ -2167,16 +2266,18 @@ void SelectDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 void PSelectDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals;
+   SelFeat_p feat = SEL_FEATURES(clause);
    bool found = false;
 
    while(handle)
    {
-      if(EqnDepth(handle)<=2)
+      if(SelFeatDepth(feat)<=2)
       {
          found = true;
          break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(!found)
    {
@@ -2205,16 +2306,18 @@ void PSelectDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 void SelectPDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals;
+   SelFeat_p feat = SEL_FEATURES(clause);
    bool found = false;
 
    while(handle)
    {
-      if(EqnIsPositive(handle) && (EqnDepth(handle)<=2))
+      if(EqnIsPositive(handle) && (SelFeatDepth(feat)<=2))
       {
          found = true;
          break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(!found)
    {
@@ -2242,16 +2345,18 @@ void SelectPDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 void PSelectPDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals;
+   SelFeat_p feat = SEL_FEATURES(clause);
    bool found = false;
 
    while(handle)
    {
-      if(EqnIsPositive(handle) && (EqnDepth(handle)<=2))
+      if(EqnIsPositive(handle) && (SelFeatDepth(feat)<=2))
       {
          found = true;
          break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(!found)
    {
@@ -2280,16 +2385,18 @@ void PSelectPDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 void SelectNDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals;
+   SelFeat_p feat = SEL_FEATURES(clause);
    bool found = false;
 
    while(handle)
    {
-      if(EqnIsNegative(handle) && (EqnDepth(handle)<=2))
+      if(EqnIsNegative(handle) && (SelFeatDepth(feat)<=2))
       {
          found = true;
          break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(!found)
    {
@@ -2317,16 +2424,18 @@ void SelectNDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 void PSelectNDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 {
    Eqn_p handle = clause->literals;
+   SelFeat_p feat = SEL_FEATURES(clause);
    bool found = false;
 
    while(handle)
    {
-      if(EqnIsNegative(handle) && (EqnDepth(handle)<=2))
+      if(EqnIsNegative(handle) && (SelFeatDepth(feat)<=2))
       {
          found = true;
          break;
       }
       handle = handle->next;
+      SEL_NEXT(feat);
    }
    if(!found)
    {
@@ -2354,7 +2463,7 @@ void PSelectNDepth2OptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void SelectNonRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsRangeRestricted(clause))
+   if(!SelClauseIsRangeRestricted(clause))
    {
       SelectOptimalLiteral(ocb,clause);
    }
@@ -2376,7 +2485,7 @@ void SelectNonRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void PSelectNonRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsRangeRestricted(clause))
+   if(!SelClauseIsRangeRestricted(clause))
    {
       PSelectOptimalLiteral(ocb,clause);
    }
@@ -2398,7 +2507,7 @@ void PSelectNonRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void SelectNonStrongRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsStronglyRangeRestricted(clause))
+   if(!SelClauseIsStronglyRangeRestricted(clause))
    {
       SelectOptimalLiteral(ocb,clause);
    }
@@ -2420,7 +2529,7 @@ void SelectNonStrongRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void PSelectNonStrongRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsStronglyRangeRestricted(clause))
+   if(!SelClauseIsStronglyRangeRestricted(clause))
    {
       PSelectOptimalLiteral(ocb,clause);
    }
@@ -2450,7 +2559,7 @@ void SelectAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
    {
       return;
    }
-   if(ClauseIsAntiRangeRestricted(clause))
+   if(SelClauseIsAntiRangeRestricted(clause))
    {
       SelectOptimalLiteral(ocb,clause);
    }
@@ -2472,7 +2581,7 @@ void SelectAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void PSelectAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(ClauseIsAntiRangeRestricted(clause))
+   if(SelClauseIsAntiRangeRestricted(clause))
    {
       PSelectOptimalLiteral(ocb,clause);
    }
@@ -2494,7 +2603,7 @@ void PSelectAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void SelectNonAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsAntiRangeRestricted(clause))
+   if(!SelClauseIsAntiRangeRestricted(clause))
    {
       SelectOptimalLiteral(ocb,clause);
    }
@@ -2516,7 +2625,7 @@ void SelectNonAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void PSelectNonAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsAntiRangeRestricted(clause))
+   if(!SelClauseIsAntiRangeRestricted(clause))
    {
       PSelectOptimalLiteral(ocb,clause);
    }
@@ -2538,8 +2647,8 @@ void PSelectNonAntiRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void SelectStrongRRNonRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsRangeRestricted(clause)||
-      ClauseIsStronglyRangeRestricted(clause))
+   if(!SelClauseIsRangeRestricted(clause)||
+      SelClauseIsStronglyRangeRestricted(clause))
    {
       SelectOptimalLiteral(ocb,clause);
    }
@@ -2561,8 +2670,8 @@ void SelectStrongRRNonRROptimalLiteral(OCB_p ocb, Clause_p clause)
 
 void PSelectStrongRRNonRROptimalLiteral(OCB_p ocb, Clause_p clause)
 {
-   if(!ClauseIsRangeRestricted(clause)||
-      ClauseIsStronglyRangeRestricted(clause))
+   if(!SelClauseIsRangeRestricted(clause)||
+      SelClauseIsStronglyRangeRestricted(clause))
    {
       PSelectOptimalLiteral(ocb,clause);
    }
@@ -2884,7 +2993,7 @@ void SelectComplex(OCB_p ocb, Clause_p clause)
    Eqn_p handle, selected;
    long select_weight, weight;
 
-   selected = ClauseFindNegPureVarLit(clause);
+   selected = SelClauseFindNegPureVarLit(clause);
 
    if(!selected)
    {
@@ -2936,7 +3045,7 @@ void PSelectComplex(OCB_p ocb, Clause_p clause)
    Eqn_p handle, selected;
    long select_weight, weight;
 
-   selected = ClauseFindNegPureVarLit(clause);
+   selected = SelClauseFindNegPureVarLit(clause);
 
    if(!selected)
    {
@@ -2982,7 +3091,7 @@ void PSelectComplex(OCB_p ocb, Clause_p clause)
 
 void SelectComplexExceptRRHorn(OCB_p ocb, Clause_p clause)
 {
-   if(!(ClauseIsHorn(clause) && ClauseIsRangeRestricted(clause)))
+   if(!(ClauseIsHorn(clause) && SelClauseIsRangeRestricted(clause)))
    {
       SelectComplex(ocb, clause);
    }
@@ -3004,7 +3113,7 @@ void SelectComplexExceptRRHorn(OCB_p ocb, Clause_p clause)
 
 void PSelectComplexExceptRRHorn(OCB_p ocb, Clause_p clause)
 {
-   if(!(ClauseIsHorn(clause) && ClauseIsRangeRestricted(clause)))
+   if(!(ClauseIsHorn(clause) && SelClauseIsRangeRestricted(clause)))
    {
       PSelectComplex(ocb, clause);
    }
@@ -3029,7 +3138,7 @@ void SelectLComplex(OCB_p ocb, Clause_p clause)
    Eqn_p handle, selected;
    long select_weight, weight;
 
-   selected = ClauseFindNegPureVarLit(clause);
+   selected = SelClauseFindNegPureVarLit(clause);
 
    if(!selected)
    {
@@ -3078,7 +3187,7 @@ void PSelectLComplex(OCB_p ocb, Clause_p clause)
    Eqn_p handle, selected;
    long select_weight, weight;
 
-   selected = ClauseFindNegPureVarLit(clause);
+   selected = SelClauseFindNegPureVarLit(clause);
 
    if(!selected)
    {
@@ -4510,15 +4619,15 @@ static void maxlcomplex_weight(LitEval_p lit, Clause_p clause, void *dummy)
       {
          lit->w1=100;
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!SelFeatIsPureVar(SEL_EVAL_FEAT(lit)))
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!SelFeatIsGround(SEL_EVAL_FEAT(lit)))
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
+      lit->w2 = -sel_diff_weight(SEL_EVAL_FEAT(lit));
       lit->w3 = literal_weight_counter % clause->neg_lit_no;
    }
    literal_weight_counter++;
@@ -4589,15 +4698,15 @@ static void maxlcomplexavoidpred_weight(LitEval_p lit, Clause_p clause,
       {
          lit->w1=100;
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!SelFeatIsPureVar(SEL_EVAL_FEAT(lit)))
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!SelFeatIsGround(SEL_EVAL_FEAT(lit)))
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
+      lit->w2 = -sel_diff_weight(SEL_EVAL_FEAT(lit));
       if(EqnIsEquLit(lit->literal))
       {
          lit->w3 = PDArrayElementInt(pd, 0);
@@ -4673,7 +4782,7 @@ static void maxlcomplexappNTNp_weight(LitEval_p lit, Clause_p clause,
 
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsTypePred(lit->literal)||EqnIsPropositional(lit->literal))
+      if(SelFeatIsTypePred(SEL_EVAL_FEAT(lit))||EqnIsPropositional(lit->literal))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
@@ -4689,15 +4798,15 @@ static void maxlcomplexappNTNp_weight(LitEval_p lit, Clause_p clause,
             lit->w1=100;
          }
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!SelFeatIsPureVar(SEL_EVAL_FEAT(lit)))
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!SelFeatIsGround(SEL_EVAL_FEAT(lit)))
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
+      lit->w2 = -sel_diff_weight(SEL_EVAL_FEAT(lit));
       if(EqnIsEquLit(lit->literal))
       {
          lit->w3 = PDArrayElementInt(pd, 0);
@@ -4769,7 +4878,7 @@ static void maxlcomplexavoidprednotype_weight(LitEval_p lit, Clause_p clause,
                                         void *pred_dist)
 {
    maxlcomplexavoidpred_weight(lit, clause, pred_dist);
-   if(EqnIsTypePred(lit->literal))
+   if(SelFeatIsTypePred(SEL_EVAL_FEAT(lit)))
    {
       lit->forbidden = true;
    }
@@ -4877,19 +4986,19 @@ static void complex_weight(LitEval_p lit, Clause_p clause,
 {
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsPureVar(lit->literal))
+      if(SelFeatIsPureVar(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 0;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(SelFeatIsGround(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 10;
-         lit->w2 = EqnStandardWeight(lit->literal);
+         lit->w2 = SelFeatStandardWeight(SEL_EVAL_FEAT(lit));
       }
       else
       {
          lit->w1 = 20;
-         lit->w2 = -lit_sel_diff_weight(lit->literal);
+         lit->w2 = -sel_diff_weight(SEL_EVAL_FEAT(lit));
       }
    }
 }
@@ -4938,19 +5047,19 @@ static void complex_weight_ahp(LitEval_p lit, Clause_p clause,
 
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsPureVar(lit->literal))
+      if(SelFeatIsPureVar(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 0;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(SelFeatIsGround(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 10;
-         lit->w2 = EqnStandardWeight(lit->literal);
+         lit->w2 = SelFeatStandardWeight(SEL_EVAL_FEAT(lit));
       }
       else
       {
          lit->w1 = 20;
-         lit->w2 = -lit_sel_diff_weight(lit->literal);
+         lit->w2 = -sel_diff_weight(SEL_EVAL_FEAT(lit));
       }
    }
    lit->w3 = 0;
@@ -5045,24 +5154,24 @@ static void new_complex_notp_ahp(LitEval_p lit, Clause_p clause,
 
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsGround(lit->literal))
+      if(SelFeatIsGround(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 0;
          lit->w2 = TermStandardWeight(lit->literal->lterm);
       }
-      else if(!EqnIsXTypePred(lit->literal))
+      else if(!SelFeatIsXTypePred(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 10;
          lit->w2 = EqnMaxTermPositions(lit->literal);
       }
-      else if(!EqnIsTypePred(lit->literal))
+      else if(!SelFeatIsTypePred(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 20;
          lit->w2 = -TermStandardWeight(lit->literal->lterm);
       }
       else
       {
-         assert(EqnIsTypePred(lit->literal));
+         assert(SelFeatIsTypePred(SEL_EVAL_FEAT(lit)));
          lit->w1 = 100000;
          lit->forbidden = 1;
       }
@@ -5152,7 +5261,7 @@ void PSelectNewComplexAHP(OCB_p ocb, Clause_p clause)
 
 void SelectComplexAHPExceptRRHorn(OCB_p ocb, Clause_p clause)
 {
-   if(!(ClauseIsHorn(clause) && ClauseIsRangeRestricted(clause)))
+   if(!(ClauseIsHorn(clause) && SelClauseIsRangeRestricted(clause)))
    {
       SelectComplexAHP(ocb, clause);
    }
@@ -5174,7 +5283,7 @@ void SelectComplexAHPExceptRRHorn(OCB_p ocb, Clause_p clause)
 
 void PSelectComplexAHPExceptRRHorn(OCB_p ocb, Clause_p clause)
 {
-   if(!(ClauseIsHorn(clause) && ClauseIsRangeRestricted(clause)))
+   if(!(ClauseIsHorn(clause) && SelClauseIsRangeRestricted(clause)))
    {
       PSelectComplexAHP(ocb, clause);
    }
@@ -5196,7 +5305,7 @@ void PSelectComplexAHPExceptRRHorn(OCB_p ocb, Clause_p clause)
 
 void SelectNewComplexAHPExceptRRHorn(OCB_p ocb, Clause_p clause)
 {
-   if(!(ClauseIsHorn(clause) && ClauseIsRangeRestricted(clause)))
+   if(!(ClauseIsHorn(clause) && SelClauseIsRangeRestricted(clause)))
    {
       SelectNewComplexAHP(ocb, clause);
    }
@@ -5218,7 +5327,7 @@ void SelectNewComplexAHPExceptRRHorn(OCB_p ocb, Clause_p clause)
 
 void PSelectNewComplexAHPExceptRRHorn(OCB_p ocb, Clause_p clause)
 {
-   if(!(ClauseIsHorn(clause) && ClauseIsRangeRestricted(clause)))
+   if(!(ClauseIsHorn(clause) && SelClauseIsRangeRestricted(clause)))
    {
       PSelectNewComplexAHP(ocb, clause);
    }
@@ -5312,24 +5421,24 @@ static void new_complex_notp_ahp_ns(LitEval_p lit, Clause_p clause,
          lit->w1 = 100000;
          lit->forbidden = 1;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(SelFeatIsGround(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 0;
          lit->w2 = TermStandardWeight(lit->literal->lterm);
       }
-      else if(!EqnIsXTypePred(lit->literal))
+      else if(!SelFeatIsXTypePred(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 10;
          lit->w2 = EqnMaxTermPositions(lit->literal);
       }
-      else if(!EqnIsTypePred(lit->literal))
+      else if(!SelFeatIsTypePred(SEL_EVAL_FEAT(lit)))
       {
          lit->w1 = 20;
          lit->w2 = -TermStandardWeight(lit->literal->lterm);
       }
       else
       {
-         assert(EqnIsTypePred(lit->literal));
+         assert(SelFeatIsTypePred(SEL_EVAL_FEAT(lit)));
          lit->w1 = 100000;
          lit->forbidden = 1;
       }
@@ -5401,7 +5510,7 @@ void SelectVGNonCR(OCB_p ocb, Clause_p clause)
    assert(clause->neg_lit_no);
    assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
 
-   handle = ClauseFindNegPureVarLit(clause);
+   handle = SelClauseFindNegPureVarLit(clause);
 
    if(handle)
    {
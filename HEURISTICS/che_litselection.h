@@ -44,6 +44,7 @@ typedef struct litsel_name_fun_assoc_cell
 typedef struct lit_eval_cell
 {
    Eqn_p literal;
+   LitFeature_p feat; /* Cached features of literal */
    bool  forbidden; /* Never select this; */
    bool  exclusive; /* If this is selected, select no others */
    int   w1; /* Lexicographically compared weights */
@@ -64,6 +65,7 @@ typedef void LitWeightFun(LitEval_p, Clause_p, void*);
 LiteralSelectionFun GetLitSelFun(char* name);
 char*               GetLitSelName(LiteralSelectionFun fun);
 void LitSelAppendNames(DStr_p str);
+void LitSelResetCounter(void);
 
 void SelectNoLiterals(OCB_p ocb, Clause_p clause);
 void SelectNoGeneration(OCB_p ocb, Clause_p clause);
@@ -182,6 +182,7 @@ ProofControl_p ProofControlAlloc(void)
    handle->hcbs                          = HCBAdminAlloc();
    handle->hcb                           = NULL;
    handle->ac_handling_active            = false;
+   handle->problem_specs_valid           = false;
    HeuristicParmsInitialize(&handle->heuristic_parms);
 
    return handle;
@@ -214,6 +215,30 @@ void ProofControlFree(ProofControl_p junk)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ProofControlComputeSpecs()
+//
+//   Compute the problem features of the axioms in state and store
+//   them in control, unless this has already been done.
+//
+// Global Variables: -
+//
+// Side Effects    : Sets control->problem_specs
+//
+/----------------------------------------------------------------------*/
+
+void ProofControlComputeSpecs(ProofControl_p control, ProofState_p state)
+{
+   if(!control->problem_specs_valid)
+   {
+      SpecFeaturesCompute(&(control->problem_specs),
+                          state->axioms, state->signature);
+      control->problem_specs_valid = true;
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: DoLiteralSelection()
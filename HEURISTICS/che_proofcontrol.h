@@ -46,6 +46,7 @@ typedef struct proofcontrolcell
    HeuristicParmsCell  heuristic_parms;
    FVIndexParmsCell    fvi_parms;
    SpecFeatureCell     problem_specs;
+   bool                problem_specs_valid; /* Already computed? */
 }ProofControlCell, *ProofControl_p;
 
 #define HCBARGUMENTS ProofState_p state, ProofControl_p control, \
@@ -68,6 +69,8 @@ extern  char* DefaultHeuristics;
 
 ProofControl_p ProofControlAlloc(void);
 void           ProofControlFree(ProofControl_p junk);
+void           ProofControlComputeSpecs(ProofControl_p control,
+                                        ProofState_p state);
 
 void           DoLiteralSelection(ProofControl_p control, Clause_p
               clause);
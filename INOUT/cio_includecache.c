@@ -0,0 +1,549 @@
+/*-----------------------------------------------------------------------
+
+File  : cio_includecache.c
+
+Author: agent
+
+Contents
+
+  Persistent cache of tokenized include files.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 23:05:17 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "cio_includecache.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Directory for cached include files, NULL disables the cache. */
+
+char* IncludeCacheDir = NULL;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: buf_put_bytes()
+//
+//   Append len bytes from data to buf.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void buf_put_bytes(CacheBuf_p buf, const void* data, long len)
+{
+   while(buf->len+len > buf->size)
+   {
+      buf->size *= 2;
+      buf->data = SecureRealloc(buf->data, buf->size);
+   }
+   memcpy(buf->data+buf->len, data, len);
+   buf->len += len;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: buf_put_varint()
+//
+//   Append val to buf as an unsigned LEB128 number.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void buf_put_varint(CacheBuf_p buf, uint64_t val)
+{
+   unsigned char bytes[16];
+   int           len = 0;
+
+   while(val >= 0x80)
+   {
+      bytes[len++] = (val & 0x7f) | 0x80;
+      val >>= 7;
+   }
+   bytes[len++] = val;
+   buf_put_bytes(buf, bytes, len);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: reader_get_byte()
+//
+//   Return the next byte from reader, or 0 (and clear reader->ok) at
+//   the end of the data.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static unsigned char reader_get_byte(CacheReader_p reader)
+{
+   if(reader->pos >= reader->end)
+   {
+      reader->ok = false;
+      return 0;
+   }
+   return *(reader->pos++);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: reader_get_varint()
+//
+//   Read an unsigned LEB128 number from reader.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static uint64_t reader_get_varint(CacheReader_p reader)
+{
+   uint64_t      res = 0;
+   unsigned char byte;
+   int           shift = 0;
+
+   do
+   {
+      byte = reader_get_byte(reader);
+      if(shift < 64)
+      {
+         res |= (uint64_t)(byte & 0x7f) << shift;
+      }
+      shift += 7;
+   }while((byte & 0x80) && reader->ok);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: reader_get_bytes()
+//
+//   Return a pointer to the next len bytes of reader and skip them,
+//   or NULL (clearing reader->ok) if there are not enough left.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static unsigned char* reader_get_bytes(CacheReader_p reader,
+                                       uint64_t len)
+{
+   unsigned char *res = reader->pos;
+
+   if(len > (uint64_t)(reader->end-reader->pos))
+   {
+      reader->ok = false;
+      return NULL;
+   }
+   reader->pos += len;
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: mem_hash()
+//
+//   Return a hash of len bytes starting at data. This is FNV-1a
+//   applied to 8 byte words (and the remaining single bytes), which
+//   is much faster than the bytewise version on large inputs.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static StrHashType mem_hash(const unsigned char* data, long len)
+{
+   StrHashType hash = STR_HASH_INIT;
+   uint64_t    word;
+   long        i;
+
+   for(i=0; i+8<=len; i+=8)
+   {
+      memcpy(&word, data+i, 8);
+      hash = (hash^word)*STR_HASH_PRIME;
+   }
+   for(; i<len; i++)
+   {
+      hash = StrHashStep(hash, data[i]);
+   }
+   return hash;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_key()
+//
+//   Return the canonical path of the file read by in (or its name if
+//   the path cannot be resolved) as a new DStr.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static DStr_p cache_key(Scanner_p in)
+{
+   DStr_p key  = DStrAlloc();
+   char*  path = realpath(DStrView(Source(in)), NULL);
+
+   if(path)
+   {
+      DStrAppendStr(key, path);
+      free(path);
+   }
+   else
+   {
+      DStrAppendDStr(key, Source(in));
+   }
+   return key;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_entry_name()
+//
+//   Return the name of the cache entry for the file with the given
+//   key as a new DStr.
+//
+// Global Variables: IncludeCacheDir
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static DStr_p cache_entry_name(DStr_p key)
+{
+   DStr_p name = DStrAlloc();
+   char   hash[17];
+
+   sprintf(hash, "%016" PRIx64, StrHash(DStrView(key)));
+   DStrAppendStr(name, IncludeCacheDir);
+   DStrAppendChar(name, '/');
+   DStrAppendStr(name, hash);
+   DStrAppendStr(name, INCLUDE_CACHE_SUFFIX);
+
+   return name;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: file_mtime()
+//
+//   Store the modification time of the file described by stat_buf in
+//   *sec and *nsec.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void file_mtime(struct stat* stat_buf, uint64_t *sec,
+                       uint64_t *nsec)
+{
+   *sec  = stat_buf->st_mtime;
+#ifdef __APPLE__
+   *nsec = stat_buf->st_mtimespec.tv_nsec;
+#else
+   *nsec = stat_buf->st_mtim.tv_nsec;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: read_entry()
+//
+//   Read the cache entry file completely into a new buffer and return
+//   it (the size is stored in *len), or return NULL if it cannot be
+//   read.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static unsigned char* read_entry(char* name, long *len)
+{
+   FILE*          file;
+   struct stat    stat_buf;
+   unsigned char* res = NULL;
+
+   file = fopen(name, "rb");
+   if(!file)
+   {
+      return NULL;
+   }
+   if(fstat(fileno(file), &stat_buf) == 0 && stat_buf.st_size > 0)
+   {
+      *len = stat_buf.st_size;
+      res  = SecureMalloc(*len);
+      if(fread(res, 1, *len, file) != (size_t)*len)
+      {
+         FREE(res);
+         res = NULL;
+      }
+   }
+   fclose(file);
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: IncludeCacheLoad()
+//
+//   If the cache holds an entry for the (unchanged) file read by in,
+//   make in replay it and return true. Otherwise return false and
+//   leave in alone. in has to be ScannerCacheable().
+//
+// Global Variables: IncludeCacheDir
+//
+// Side Effects    : Input, memory operations, may refresh the entry
+//
+/----------------------------------------------------------------------*/
+
+bool IncludeCacheLoad(Scanner_p in)
+{
+   DStr_p          key, name;
+   unsigned char   *data, *path;
+   long            len;
+   uint64_t        path_len, mtime_sec, mtime_nsec;
+   uint64_t        e_size, e_sec, e_nsec, e_hash, t_len, t_hash;
+   struct stat     stat_buf;
+   CacheReaderCell reader;
+   TokenTape_p     tape;
+   bool            res = false, refresh = false;
+
+   assert(IncludeCacheDir);
+   assert(ScannerCacheable(in));
+
+   key  = cache_key(in);
+   name = cache_entry_name(key);
+   data = read_entry(DStrView(name), &len);
+   if(data && stat(DStrView(Source(in)), &stat_buf) == 0)
+   {
+      file_mtime(&stat_buf, &mtime_sec, &mtime_nsec);
+      reader.pos = data;
+      reader.end = data+len;
+      reader.ok  = true;
+
+      if(reader_get_bytes(&reader, strlen(INCLUDE_CACHE_MAGIC)) &&
+         memcmp(data, INCLUDE_CACHE_MAGIC, strlen(INCLUDE_CACHE_MAGIC))==0)
+      {
+         path_len = reader_get_varint(&reader);
+         path     = reader_get_bytes(&reader, path_len);
+         e_size   = reader_get_varint(&reader);
+         e_sec    = reader_get_varint(&reader);
+         e_nsec   = reader_get_varint(&reader);
+         e_hash   = reader_get_varint(&reader);
+         t_len    = reader_get_varint(&reader);
+         t_hash   = reader_get_varint(&reader);
+
+         if(reader.ok &&
+            path_len == (uint64_t)DStrLen(key) &&
+            memcmp(path, DStrView(key), path_len)==0 &&
+            e_size == (uint64_t)in->source->size &&
+            t_len == (uint64_t)(reader.end-reader.pos) &&
+            t_hash == mem_hash(reader.pos, t_len))
+         {
+            if(e_sec != mtime_sec || e_nsec != mtime_nsec)
+            {
+               /* Touched, but maybe not changed */
+               refresh = (e_hash ==
+                          mem_hash((unsigned char*)in->source->data,
+                                   in->source->size));
+               res = refresh;
+            }
+            else
+            {
+               res = true;
+            }
+         }
+      }
+   }
+   if(res)
+   {
+      tape = TokenTapeCellAlloc();
+      tape->data  = data;
+      tape->start = reader.pos-data;
+      tape->len   = len;
+      tape->size  = len;
+      ScannerReplayTape(in, tape);
+      VERBOUTARG2("Include cache hit for ", DStrView(Source(in)));
+      if(refresh)
+      {
+         IncludeCacheStore(in, tape);
+      }
+   }
+   else if(data)
+   {
+      FREE(data);
+   }
+   DStrFree(name);
+   DStrFree(key);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: IncludeCacheStore()
+//
+//   Write tape (recorded from in, which must still hold the complete
+//   input) to the cache. The entry is replaced atomically. Failures
+//   are not fatal, the file is just not cached.
+//
+// Global Variables: IncludeCacheDir
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void IncludeCacheStore(Scanner_p in, TokenTape_p tape)
+{
+   DStr_p        key, name, tmpname;
+   CacheBufCell  buf;
+   struct stat   stat_buf;
+   uint64_t      mtime_sec, mtime_nsec;
+   long          t_len = tape->len-tape->start;
+   FILE*         out;
+   bool          ok;
+
+   assert(IncludeCacheDir);
+   assert(in->source && in->source->mapped);
+
+   if(stat(DStrView(Source(in)), &stat_buf) != 0)
+   {
+      return;
+   }
+   file_mtime(&stat_buf, &mtime_sec, &mtime_nsec);
+   key = cache_key(in);
+
+   buf.size = 1024;
+   buf.len  = 0;
+   buf.data = SecureMalloc(buf.size);
+   buf_put_bytes(&buf, INCLUDE_CACHE_MAGIC, strlen(INCLUDE_CACHE_MAGIC));
+   buf_put_varint(&buf, DStrLen(key));
+   buf_put_bytes(&buf, DStrView(key), DStrLen(key));
+   buf_put_varint(&buf, in->source->size);
+   buf_put_varint(&buf, mtime_sec);
+   buf_put_varint(&buf, mtime_nsec);
+   buf_put_varint(&buf, mem_hash((unsigned char*)in->source->data,
+                                 in->source->size));
+   buf_put_varint(&buf, t_len);
+   buf_put_varint(&buf, mem_hash(tape->data+tape->start, t_len));
+
+   mkdir(IncludeCacheDir, 0777); /* Failure shows up below */
+   name    = cache_entry_name(key);
+   tmpname = DStrAlloc();
+   DStrAppendDStr(tmpname, name);
+   DStrAppendChar(tmpname, '.');
+   DStrAppendInt(tmpname, getpid());
+   out = fopen(DStrView(tmpname), "wb");
+   if(out)
+   {
+      ok = (fwrite(buf.data, 1, buf.len, out) == (size_t)buf.len) &&
+         (fwrite(tape->data+tape->start, 1, t_len, out) == (size_t)t_len);
+      ok = (fclose(out) == 0) && ok;
+      if(ok && rename(DStrView(tmpname), DStrView(name)) == 0)
+      {
+         VERBOUTARG2("Include cache entry written for ",
+                     DStrView(Source(in)));
+      }
+      else
+      {
+         unlink(DStrView(tmpname));
+      }
+   }
+   DStrFree(tmpname);
+   DStrFree(name);
+   DStrFree(key);
+   FREE(buf.data);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: IncludeCacheRecord()
+//
+//   If the include cache is enabled and in is ScannerCacheable()
+//   (i.e. it has not been served from the cache), record the file,
+//   add it to the cache and make in replay the recorded tape.
+//   Otherwise do nothing.
+//
+// Global Variables: IncludeCacheDir
+//
+// Side Effects    : Input, output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void IncludeCacheRecord(Scanner_p in)
+{
+   TokenTape_p tape;
+
+   if(!IncludeCacheDir || !ScannerCacheable(in))
+   {
+      return;
+   }
+   tape = TokenTapeAlloc();
+   ScannerRecordTape(in, tape);
+   IncludeCacheStore(in, tape);
+   ScannerReplayTape(in, tape);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
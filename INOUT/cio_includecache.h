@@ -0,0 +1,91 @@
+/*-----------------------------------------------------------------------
+
+File  : cio_includecache.h
+
+Author: agent
+
+Contents
+
+  A persistent on-disk cache of tokenized include files. For each
+  included file, the token tape (see cio_scanner.h) is stored in a
+  compact binary encoding in a cache directory, keyed by the path of
+  the file and checked against the size, modification time and
+  content hash of the file. If the file has not changed, later runs
+  replay the stored tape instead of reading and scanning the source
+  again. Parsing proper is not affected, so the resulting formulas,
+  clauses and signature are identical to those of an uncached run.
+
+  An entry consists of
+
+  "ETAPE01\n" <path> <size> <mtime_sec> <mtime_nsec> <content hash>
+  <tape length> <tape hash> <tape>
+
+  where all numbers are unsigned LEB128 varints, <path> is a
+  length-prefixed string and <tape> are the bytes of the encoded
+  token tape (see cio_scanner.h). The tape hash guards against
+  damaged entries.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 23:05:17 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CIO_INCLUDECACHE
+
+#define CIO_INCLUDECACHE
+
+#include <inttypes.h>
+#include <cio_scanner.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define INCLUDE_CACHE_MAGIC "ETAPE01\n"
+#define INCLUDE_CACHE_SUFFIX ".etape"
+
+/* A growing byte buffer for encoding, and a cursor for decoding,
+   entry headers. */
+
+typedef struct cache_buf_cell
+{
+   unsigned char *data;
+   long          len;
+   long          size;
+}CacheBufCell, *CacheBuf_p;
+
+typedef struct cache_reader_cell
+{
+   unsigned char *pos;
+   unsigned char *end;
+   bool          ok;   /* Cleared on reading past the end */
+}CacheReaderCell, *CacheReader_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern char* IncludeCacheDir;
+
+#define ScannerCacheable(in) \
+   ((in)->ignore_comments && !(in)->include_key && !(in)->tape && \
+    (in)->source && !(in)->source->next && (in)->source->mapped)
+
+bool IncludeCacheLoad(Scanner_p in);
+void IncludeCacheStore(Scanner_p in, TokenTape_p tape);
+void IncludeCacheRecord(Scanner_p in);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -20,6 +20,8 @@ Changes
 
 <1> Fri Nov 28 11:55:59 MET 1997
     New
+<2> Mon Oct 19 21:14:32 CEST 2026
+    Large output buffers
 
 -----------------------------------------------------------------------*/
 
@@ -58,7 +60,9 @@ int   GlobalOutFD = STDOUT_FILENO;
 // Function: OpenGlobalOut()
 //
 //   Set GobalOut to a FILE* connected to file outname, set
-//   GlobalOutFD accordingly.
+//   GlobalOutFD accordingly. If this is stdout and not a terminal,
+//   give it a large buffer (files get one from OutOpen()). Must be
+//   called before anything is written to stdout.
 //
 // Global Variables: GlobalOut, GlobalOutFD
 //
@@ -70,6 +74,10 @@ void OpenGlobalOut(char* outname)
 {
    GlobalOut   = OutOpen(outname);
    GlobalOutFD = fileno(GlobalOut);
+   if(GlobalOut == stdout && !isatty(GlobalOutFD))
+   {
+      setvbuf(GlobalOut, NULL, _IOFBF, OUT_BUFFER_SIZE);
+   }
 }
 
 
@@ -79,7 +87,8 @@ void OpenGlobalOut(char* outname)
 // Function: OutOpen()
 //
 //   Open a file for writing and return it, with error checking. "-"
-//   and NULL are both taken to mean stdout.
+//   and NULL are both taken to mean stdout. Files are fully buffered
+//   with OUT_BUFFER_SIZE bytes.
 //
 // Global Variables: -
 //
@@ -103,6 +112,7 @@ FILE* OutOpen(char* name)
     sprintf(ErrStr, "Cannot open file %s", name);
          SysError(ErrStr, FILE_ERROR);
       }
+      setvbuf(out, NULL, _IOFBF, OUT_BUFFER_SIZE);
    }
    else
    {
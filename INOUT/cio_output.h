@@ -10,6 +10,12 @@ Contents
   convention and error checking. Much simpler than the input, because
   much less can go wrong with output...
 
+  The printers for terms, clauses and derivations write many short
+  pieces. Output files get a large stdio buffer (so that a flush is
+  one big write()), and the inline functions below write characters,
+  strings and integers without locking the stream or interpreting a
+  format string.
+
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -20,6 +26,8 @@ Changes
 
 <1> Fri Nov 28 11:55:59 MET 1997
     New
+<2> Mon Oct 19 21:14:32 CEST 2026
+    Large output buffers, unlocked character/string/integer output
 
 -----------------------------------------------------------------------*/
 
@@ -38,6 +46,13 @@ Changes
 #define OUTPRINT(level, message)\
     if(level<= OutputLevel){fprintf(GlobalOut, message);}
 
+/* Buffer size for output files and non-interactive stdout */
+#define OUT_BUFFER_SIZE (256*1024)
+
+/* E is single-threaded where it prints, so we do not need to lock
+   the stream for every character. */
+#define OutPutc(c, out) putc_unlocked((c), (out))
+
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
@@ -53,6 +68,70 @@ FILE*        OutOpen(char* name);
 void         OutClose(FILE* file);
 void         PrintDashedStatuses(FILE* out, char *stat1, char *stat2, char *fallback);
 
+static __inline__ void OutPuts(FILE* out, const char* str);
+static __inline__ void OutPrintLong(FILE* out, long val);
+
+
+/*---------------------------------------------------------------------*/
+/*                      Inline functions                               */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: OutPuts()
+//
+//   Write str to out (like fputs(), but without locking).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void OutPuts(FILE* out, const char* str)
+{
+   while(*str)
+   {
+      OutPutc(*str, out);
+      str++;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: OutPrintLong()
+//
+//   Write val to out in decimal (like fprintf(out, "%ld", val)).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ void OutPrintLong(FILE* out, long val)
+{
+   char          buf[24], *pos = buf+sizeof(buf);
+   unsigned long uval = val;
+
+   if(val < 0)
+   {
+      OutPutc('-', out);
+      uval = -uval;
+   }
+   do
+   {
+      *--pos = '0'+uval%10;
+      uval /= 10;
+   }while(uval);
+   while(pos < buf+sizeof(buf))
+   {
+      OutPutc(*pos, out);
+      pos++;
+   }
+}
+
 #endif
 
 /*---------------------------------------------------------------------*/
@@ -0,0 +1,282 @@
+/*-----------------------------------------------------------------------
+
+File  : cio_prefetch.c
+
+Author: agent
+
+Contents
+
+  Parallel tokenization of included files.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 21:12:40 CEST 2026
+    New
+<2> Mon Oct 19 23:05:17 CEST 2026
+    Pass through scanners replaying cached tapes
+
+-----------------------------------------------------------------------*/
+
+#include "cio_prefetch.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Number of worker threads for tokenizing includes, 0 reads
+   includes strictly in sequence. */
+
+int IncludePrefetchThreads = 0;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: prefetch_run_job()
+//
+//   Record the tape for job (which the caller has claimed) and mark
+//   it as done. Has to be called without holding the lock.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void prefetch_run_job(IncludePrefetch_p prefetch, PrefetchJob_p job)
+{
+   if(job->tape)
+   {
+      ScannerRecordTape(job->in, job->tape);
+   }
+   pthread_mutex_lock(&(prefetch->lock));
+   job->done = true;
+   if(job->tape)
+   {
+      prefetch->tape_mem += TokenTapeMem(job->tape);
+   }
+   pthread_cond_broadcast(&(prefetch->changed));
+   pthread_mutex_unlock(&(prefetch->lock));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: prefetch_worker()
+//
+//   Thread function: Record jobs in order until all have been
+//   started. Jobs beyond the one the parser needs next are only
+//   started while the unclaimed tapes stay below PREFETCH_TAPE_MEM.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void* prefetch_worker(void* arg)
+{
+   IncludePrefetch_p prefetch = arg;
+   PrefetchJob_p     job;
+
+   pthread_mutex_lock(&(prefetch->lock));
+   while(prefetch->next_job < prefetch->count)
+   {
+      if(prefetch->tape_mem > PREFETCH_TAPE_MEM &&
+         prefetch->next_job > prefetch->next_get)
+      {
+         pthread_cond_wait(&(prefetch->changed), &(prefetch->lock));
+         continue;
+      }
+      job = &(prefetch->jobs[prefetch->next_job++]);
+      pthread_mutex_unlock(&(prefetch->lock));
+      prefetch_run_job(prefetch, job);
+      pthread_mutex_lock(&(prefetch->lock));
+   }
+   pthread_mutex_unlock(&(prefetch->lock));
+
+   return NULL;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: IncludePrefetchStart()
+//
+//   Start recording the scanners on the stack (which may contain
+//   NULL for skipped files) using up to threads worker threads. All
+//   non-NULL scanners have to be ScannerPrefetchable(). Scanners that
+//   already replay a tape are passed through unchanged. The scanners
+//   are handed back one by one (in stack order) by
+//   IncludePrefetchGet().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, starts threads
+//
+/----------------------------------------------------------------------*/
+
+IncludePrefetch_p IncludePrefetchStart(PStack_p scanners, int threads)
+{
+   IncludePrefetch_p handle = IncludePrefetchCellAlloc();
+   PStackPointer     i;
+   Scanner_p         in;
+
+   handle->count    = PStackGetSP(scanners);
+   handle->jobs     = SecureMalloc(MAX(handle->count,1)*sizeof(PrefetchJobCell));
+   handle->next_job = 0;
+   handle->next_get = 0;
+   handle->tape_mem = 0;
+   for(i=0; i<handle->count; i++)
+   {
+      in = PStackElementP(scanners, i);
+      assert(!in || ScannerPrefetchable(in));
+      handle->jobs[i].in   = in;
+      /* Scanners already replaying (from the include cache) need no
+         recording */
+      handle->jobs[i].tape = (in && !in->tape)?TokenTapeAlloc():NULL;
+      handle->jobs[i].done = false;
+   }
+   pthread_mutex_init(&(handle->lock), NULL);
+   pthread_cond_init(&(handle->changed), NULL);
+
+   threads = MIN(threads, handle->count);
+   handle->workers = SecureMalloc(MAX(threads,1)*sizeof(pthread_t));
+   for(handle->threads=0; handle->threads < threads; handle->threads++)
+   {
+      if(pthread_create(&(handle->workers[handle->threads]), NULL,
+                        prefetch_worker, handle)!=0)
+      {
+         /* The parser records anything left over itself */
+         break;
+      }
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: IncludePrefetchGet()
+//
+//   Return the next scanner (or NULL for a skipped include), set up
+//   to replay its tape. Waits for the tape if necessary, or records
+//   it in the calling thread if no worker has started it yet. Newly
+//   recorded tapes are added to the include cache (if enabled). The
+//   caller takes over the scanner.
+//
+// Global Variables: IncludeCacheDir
+//
+// Side Effects    : May read input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+Scanner_p IncludePrefetchGet(IncludePrefetch_p prefetch)
+{
+   PrefetchJob_p job;
+
+   assert(prefetch->next_get < prefetch->count);
+
+   pthread_mutex_lock(&(prefetch->lock));
+   job = &(prefetch->jobs[prefetch->next_get]);
+   if(prefetch->next_job == prefetch->next_get)
+   {
+      prefetch->next_job++;
+      pthread_mutex_unlock(&(prefetch->lock));
+      prefetch_run_job(prefetch, job);
+      pthread_mutex_lock(&(prefetch->lock));
+   }
+   while(!job->done)
+   {
+      pthread_cond_wait(&(prefetch->changed), &(prefetch->lock));
+   }
+   if(job->tape)
+   {
+      prefetch->tape_mem -= TokenTapeMem(job->tape);
+   }
+   prefetch->next_get++;
+   pthread_cond_broadcast(&(prefetch->changed));
+   pthread_mutex_unlock(&(prefetch->lock));
+
+   if(job->tape)
+   {
+      ScannerReplayTape(job->in, job->tape);
+      if(IncludeCacheDir &&
+         job->in->source->mapped && !job->in->source->next)
+      {
+         IncludeCacheStore(job->in, job->tape);
+      }
+      job->tape = NULL;
+   }
+   return job->in;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: IncludePrefetchFree()
+//
+//   Wait for the workers and free the prefetch data, including
+//   scanners not yet taken by IncludePrefetchGet().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, joins threads
+//
+/----------------------------------------------------------------------*/
+
+void IncludePrefetchFree(IncludePrefetch_p junk)
+{
+   int  i;
+   long j;
+
+   pthread_mutex_lock(&(junk->lock));
+   junk->next_job = junk->count; /* Start nothing new */
+   pthread_cond_broadcast(&(junk->changed));
+   pthread_mutex_unlock(&(junk->lock));
+   for(i=0; i<junk->threads; i++)
+   {
+      pthread_join(junk->workers[i], NULL);
+   }
+   for(j=junk->next_get; j<junk->count; j++)
+   {
+      if(junk->jobs[j].in)
+      {
+         DestroyScanner(junk->jobs[j].in);
+         if(junk->jobs[j].tape)
+         {
+            TokenTapeFree(junk->jobs[j].tape);
+         }
+      }
+   }
+   pthread_cond_destroy(&(junk->changed));
+   pthread_mutex_destroy(&(junk->lock));
+   FREE(junk->workers);
+   FREE(junk->jobs);
+   IncludePrefetchCellFree(junk);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
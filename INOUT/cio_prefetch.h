@@ -0,0 +1,90 @@
+/*-----------------------------------------------------------------------
+
+File  : cio_prefetch.h
+
+Author: agent
+
+Contents
+
+  Tokenizing a batch of included files in parallel. Each file is read
+  by its own scanner (created by the main thread) and recorded into a
+  token tape by a worker thread. The main thread then takes the
+  scanners in the original order, switches them to replaying their
+  tapes, and parses them as usual. Since parsing proper (which
+  changes the signature and term bank) stays sequential, the result
+  is identical to that of a serial parse.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 21:12:40 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CIO_PREFETCH
+
+#define CIO_PREFETCH
+
+#include <pthread.h>
+#include <clb_pstacks.h>
+#include <cio_includecache.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Do not start recording another file while this much memory is
+   taken by tapes not yet handed to the parser. */
+
+#define PREFETCH_TAPE_MEM (256*MEGA)
+
+typedef struct prefetch_job_cell
+{
+   Scanner_p   in;    /* NULL for skipped includes */
+   TokenTape_p tape;
+   bool        done;
+}PrefetchJobCell, *PrefetchJob_p;
+
+typedef struct include_prefetch_cell
+{
+   pthread_mutex_t lock;
+   pthread_cond_t  changed;
+   long            count;
+   PrefetchJob_p   jobs;
+   long            next_job;  /* Next job to be started by a worker */
+   long            next_get;  /* Next job to be handed to the parser */
+   long            tape_mem;  /* Memory of finished, unclaimed tapes */
+   int             threads;
+   pthread_t       *workers;
+}IncludePrefetchCell, *IncludePrefetch_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern int IncludePrefetchThreads;
+
+#define IncludePrefetchCellAlloc() \
+   (IncludePrefetchCell*)SizeMalloc(sizeof(IncludePrefetchCell))
+#define IncludePrefetchCellFree(junk) \
+   SizeFree(junk, sizeof(IncludePrefetchCell))
+
+#define ScannerPrefetchable(in) \
+   ((in)->ignore_comments && !(in)->include_key)
+
+IncludePrefetch_p IncludePrefetchStart(PStack_p scanners, int threads);
+Scanner_p         IncludePrefetchGet(IncludePrefetch_p prefetch);
+void              IncludePrefetchFree(IncludePrefetch_p junk);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -22,6 +22,7 @@ Changes
 -----------------------------------------------------------------------*/
 
 #include "cio_scanner.h"
+#include "cio_includecache.h"
 
 
 
@@ -86,6 +87,26 @@ static TokenRepCell token_print_rep[] =
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: accept_run()
+//
+//   Append the next len characters of the input window to the
+//   literal of the current token (in one go) and skip them.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void accept_run(Scanner_p in, long len)
+{
+   DStrAppendBuffer(AktToken(in)->literal, StreamCurrPtr(in->source), len);
+   StreamAdvance(in->source, len);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: scan_white()
@@ -101,11 +122,19 @@ static TokenRepCell token_print_rep[] =
 
 static void scan_white(Scanner_p in)
 {
+   char *run;
+   long len, avail;
+
    AktToken(in)->tok = WhiteSpace;
    while(isspace(CurrChar(in)))
    {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      run   = StreamCurrPtr(in->source);
+      avail = StreamAvail(in->source);
+      for(len=0; len<avail && isspace((unsigned char)run[len]); len++)
+      {
+         /* Just find the end */
+      }
+      accept_run(in, len);
    }
 }
 
@@ -115,7 +144,8 @@ static void scan_white(Scanner_p in)
 // Function: scan_ident()
 //
 //   Scan an identifier, d.h. an ident or an idnum. Also used for
-//   completing SemIdents.
+//   completing SemIdents. The hash of the token is continued over
+//   the identifier characters.
 //
 // Global Variables: -
 //
@@ -126,21 +156,35 @@ static void scan_white(Scanner_p in)
 static void scan_ident(Scanner_p in)
 {
    long numstart = 0,
-        i;
+        i = 0, len, avail;
+   char *run;
+   int  ch;
+   StrHashType hash = AktToken(in)->hash;
 
-   for(i=0; isidchar(CurrChar(in)); i++)
+   while(isidchar(CurrChar(in)))
    {
-      if(!numstart && isdigit(CurrChar(in)))
-      {
-    numstart = i;
-      }
-      else if(!isdigit(CurrChar(in)))
+      run   = StreamCurrPtr(in->source);
+      avail = StreamAvail(in->source);
+      for(len=0; len<avail; len++, i++)
       {
-    numstart = 0;
+         ch = (unsigned char)run[len];
+         if(!isidchar(ch))
+         {
+            break;
+         }
+         hash = StrHashStep(hash, ch);
+         if(!numstart && isdigit(ch))
+         {
+            numstart = i;
+         }
+         else if(!isdigit(ch))
+         {
+            numstart = 0;
+         }
       }
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      accept_run(in, len);
    }
+   AktToken(in)->hash = hash;
    if(numstart)
    {
       AktToken(in)->tok = Idnum;
@@ -174,12 +218,20 @@ static void scan_ident(Scanner_p in)
 
 static void scan_int(Scanner_p in)
 {
+   char *run;
+   long len, avail;
+
    AktToken(in)->tok = PosInt;
 
    while(isdigit(CurrChar(in)))
    {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      run   = StreamCurrPtr(in->source);
+      avail = StreamAvail(in->source);
+      for(len=0; len<avail && isdigit((unsigned char)run[len]); len++)
+      {
+         /* Just find the end */
+      }
+      accept_run(in, len);
    }
    errno = 0;
    AktToken(in)->numval =
@@ -211,12 +263,17 @@ static void scan_int(Scanner_p in)
 
 static void scan_line_comment(Scanner_p in)
 {
+   char *run, *nl;
+   long avail;
+
    AktToken(in)->tok = Comment;
 
    while((CurrChar(in)) != '\n' && (CurrChar(in)!=EOF))
    {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      run   = StreamCurrPtr(in->source);
+      avail = StreamAvail(in->source);
+      nl    = memchr(run, '\n', avail);
+      accept_run(in, nl?nl-run:avail);
    }
    DStrAppendChar(AktToken(in)->literal, '\n');
    NextChar(in); /* Should be harmless even at EOF */
@@ -267,6 +324,7 @@ static void scan_C_comment(Scanner_p in)
 static void scan_string(Scanner_p in, char delim)
 {
    bool escape = false;
+   StrHashType hash = StrHashStep(AktToken(in)->hash, delim);
 
    AktToken(in)->tok = (delim=='\'')?SQString:String;
 
@@ -288,9 +346,11 @@ static void scan_string(Scanner_p in, char delim)
       {
          escape = false;
       }
+      hash = StrHashStep(hash, CurrChar(in));
       DStrAppendChar(AktToken(in)->literal, CurrChar(in));
       NextChar(in);
    }
+   AktToken(in)->hash = StrHashStep(hash, delim);
    DStrAppendChar(AktToken(in)->literal, CurrChar(in));
    NextChar(in);
 }
@@ -317,6 +377,7 @@ static void scan_string(Scanner_p in, char delim)
 static Token_p scan_token(Scanner_p in)
 {
    DStrReset(AktToken(in)->literal);
+   AktToken(in)->hash = STR_HASH_INIT;
    DStrReleaseRef(AktToken(in)->source);
 
    AktToken(in)->source      = DStrGetRef(Source(in));
@@ -354,6 +415,7 @@ static Token_p scan_token(Scanner_p in)
    }
    else if((CurrChar(in)=='$') && isidchar(LookChar(in,1)))
    {
+      AktToken(in)->hash = StrHashStep(AktToken(in)->hash, '$');
       DStrAppendChar(AktToken(in)->literal, CurrChar(in));
       NextChar(in);
       scan_ident(in);
@@ -569,6 +631,235 @@ Token_p scan_token_follow_includes(Scanner_p in)
    return AktToken(in);
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: tape_get_varint()
+//
+//   Read an unsigned LEB128 number from the replay position of tape.
+//
+// Global Variables: -
+//
+// Side Effects    : Terminates on corrupted tapes
+//
+/----------------------------------------------------------------------*/
+
+static unsigned long tape_get_varint(TokenTape_p tape)
+{
+   unsigned long res = 0, byte;
+   int           shift = 0;
+
+   do
+   {
+      if(tape->pos >= tape->len || shift >= (int)(8*sizeof(unsigned long)))
+      {
+         Error("Corrupted token tape", OTHER_ERROR);
+      }
+      byte = tape->data[tape->pos++];
+      res |= (byte & 0x7f) << shift;
+      shift += 7;
+   }while(byte & 0x80);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: scan_tape_token()
+//
+//   Replay the next token from in->tape into AktToken(in). The final
+//   NoToken of the tape is repeated as often as necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, terminates on corrupted tapes
+//
+/----------------------------------------------------------------------*/
+
+static Token_p scan_tape_token(Scanner_p in)
+{
+   TokenTape_p   tape  = in->tape;
+   Token_p       token = AktToken(in);
+   long          token_start = tape->pos, line = tape->line,
+                 column = tape->column, lit;
+   unsigned long len;
+   unsigned char head;
+   int           bit;
+
+   if(tape->pos >= tape->len)
+   {
+      Error("Corrupted token tape", OTHER_ERROR);
+   }
+   head = tape->data[tape->pos++];
+   bit  = head & TAPE_TOK_MASK;
+   token->tok = 1ULL<<bit;
+   if(token->tok > FOFNor)
+   {
+      Error("Corrupted token tape", OTHER_ERROR);
+   }
+   token->skipped = (head & TAPE_SKIPPED)!=0;
+   len = tape_get_varint(tape);
+   if(len & 1)
+   {
+      tape->line  += len>>1;
+      tape->column = tape_get_varint(tape);
+   }
+   else
+   {
+      tape->column += len>>1;
+   }
+   token->line    = tape->line;
+   token->column  = tape->column;
+   if(head & TAPE_SAME_LITERAL)
+   {
+      lit = tape->last_lit[bit];
+      len = tape->last_len[bit];
+      if(lit < 0)
+      {
+         Error("Corrupted token tape", OTHER_ERROR);
+      }
+   }
+   else
+   {
+      len = tape_get_varint(tape);
+      lit = tape->pos;
+      if(len > (unsigned long)(tape->len-lit))
+      {
+         Error("Corrupted token tape", OTHER_ERROR);
+      }
+      tape->pos += len;
+      tape->last_lit[bit] = lit;
+      tape->last_len[bit] = len;
+   }
+   DStrReset(token->literal);
+   DStrAppendBuffer(token->literal, (char*)tape->data+lit, len);
+   DStrReset(token->comment);
+   token->numval = (token->tok & (PosInt|Idnum))?tape_get_varint(tape):0;
+   token->hash   = (token->tok & (Identifier|SemIdent|String|SQString))?
+      StrHash(DStrView(token->literal)):STR_HASH_INIT;
+   if(token->tok == NoToken)
+   {
+      tape->pos    = token_start;
+      tape->line   = line;
+      tape->column = column;
+   }
+   return token;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tape_put_bytes()
+//
+//   Append len bytes to tape. This only uses realloc() on blocks
+//   allocated by TokenTapeAlloc(), so it can run concurrently with
+//   the main thread (which owns the free lists).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void tape_put_bytes(TokenTape_p tape, const void* data, long len)
+{
+   while(tape->len+len > tape->size)
+   {
+      tape->size *= 2;
+      tape->data = SecureRealloc(tape->data, tape->size);
+   }
+   memcpy(tape->data+tape->len, data, len);
+   tape->len += len;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tape_put_varint()
+//
+//   Append val to tape as an unsigned LEB128 number.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void tape_put_varint(TokenTape_p tape, unsigned long val)
+{
+   unsigned char bytes[16];
+   int           len = 0;
+
+   while(val >= 0x80)
+   {
+      bytes[len++] = (val & 0x7f) | 0x80;
+      val >>= 7;
+   }
+   bytes[len++] = val;
+   tape_put_bytes(tape, bytes, len);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tape_append()
+//
+//   Append the encoding of token to tape (see cio_scanner.h).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void tape_append(TokenTape_p tape, Token_p token)
+{
+   long          len = DStrLen(token->literal);
+   unsigned char head;
+   int           bit = 0;
+
+   assert(token->tok && !(token->tok & (token->tok-1)));
+   assert(token->line > tape->line || token->column >= tape->column);
+   assert(token->hash == ((token->tok & (Identifier|SemIdent|String|SQString))?
+                          StrHash(DStrView(token->literal)):STR_HASH_INIT));
+
+   while(!(token->tok & (1ULL<<bit)))
+   {
+      bit++;
+   }
+   head = bit | (token->skipped?TAPE_SKIPPED:0);
+   if(tape->last_lit[bit] >= 0 && tape->last_len[bit] == len &&
+      memcmp(tape->data+tape->last_lit[bit], DStrView(token->literal),
+             len)==0)
+   {
+      head |= TAPE_SAME_LITERAL;
+   }
+   tape_put_bytes(tape, &head, 1);
+   if(token->line == tape->line)
+   {
+      tape_put_varint(tape, (token->column-tape->column)<<1);
+   }
+   else
+   {
+      tape_put_varint(tape, ((token->line-tape->line)<<1)|1);
+      tape_put_varint(tape, token->column);
+   }
+   tape->line   = token->line;
+   tape->column = token->column;
+   if(!(head & TAPE_SAME_LITERAL))
+   {
+      tape_put_varint(tape, len);
+      tape->last_lit[bit] = tape->len;
+      tape->last_len[bit] = len;
+      tape_put_bytes(tape, DStrView(token->literal), len);
+   }
+   if(token->tok & (PosInt|Idnum))
+   {
+      tape_put_varint(tape, token->numval);
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: scan_real_token()
@@ -584,6 +875,10 @@ Token_p scan_token_follow_includes(Scanner_p in)
 
 static Token_p scan_real_token(Scanner_p in)
 {
+   if(in->tape)
+   {
+      return scan_tape_token(in);
+   }
    AktToken(in)->skipped = false;
    DStrReset(AktToken(in)->comment);
 
@@ -808,6 +1103,7 @@ Scanner_p CreateScanner(StreamType type, char *name, bool
    handle->ignore_comments = ignore_comments;
    handle->include_key = NULL;
    handle->format = LOPFormat;
+   handle->tape = NULL;
 
    if((type == StreamTypeFile && strcmp(name,"-")==0)||
       (type != StreamTypeFile))
@@ -917,10 +1213,145 @@ void DestroyScanner(Scanner_p  junk)
    {
       FREE(junk->include_pos);
    }
+   if(junk->tape)
+   {
+      TokenTapeFree(junk->tape);
+   }
    ScannerCellFree(junk);
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TokenTapeAlloc()
+//
+//   Allocate an empty token tape.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+TokenTape_p TokenTapeAlloc(void)
+{
+   TokenTape_p handle = TokenTapeCellAlloc();
+
+   handle->size  = 8192;
+   handle->data  = SecureMalloc(handle->size);
+   handle->start = 0;
+   handle->len   = 0;
+   TokenTapeRewind(handle);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TokenTapeFree()
+//
+//   Free a token tape.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TokenTapeFree(TokenTape_p junk)
+{
+   FREE(junk->data);
+   TokenTapeCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TokenTapeRewind()
+//
+//   Reset the recording/replay state of tape to the first token.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void TokenTapeRewind(TokenTape_p tape)
+{
+   int i;
+
+   tape->pos    = tape->start;
+   tape->line   = 0;
+   tape->column = 0;
+   for(i=0; i<TAPE_TOK_TYPES; i++)
+   {
+      tape->last_lit[i] = -1;
+      tape->last_len[i] = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ScannerRecordTape()
+//
+//   Read all remaining tokens of in (starting with the current one)
+//   into tape. This does not use the free lists of the memory
+//   management, so different scanners (created by the main thread)
+//   can be recorded in different threads. in has to ignore comments
+//   and must not follow (LOP) include directives.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ScannerRecordTape(Scanner_p in, TokenTape_p tape)
+{
+   assert(in->ignore_comments);
+   assert(!in->include_key);
+   assert(!in->tape);
+
+   while(!TestInpTok(in, NoToken))
+   {
+      tape_append(tape, AktToken(in));
+      NextToken(in);
+   }
+   tape_append(tape, AktToken(in));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ScannerReplayTape()
+//
+//   Make in deliver the tokens recorded in tape (which in takes
+//   over) from the start, as if it had just been created.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ScannerReplayTape(Scanner_p in, TokenTape_p tape)
+{
+   assert(!in->tape);
+
+   in->tape  = tape;
+   TokenTapeRewind(tape);
+   for(in->current = 0; in->current < MAXTOKENLOOKAHEAD;
+       in->current++)
+   {
+      scan_real_token(in);
+   }
+   in->current = 0;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ScannerSetFormat()
@@ -1236,6 +1667,10 @@ Scanner_p ScannerParseInclude(Scanner_p in, StrTree_p *name_selector,
                                   ScannerGetDefaultDir(in));
       ScannerSetFormat(new_scanner, ScannerGetFormat(in));
       new_scanner->include_pos = pos_rep;
+      if(IncludeCacheDir && ScannerCacheable(new_scanner))
+      {
+         IncludeCacheLoad(new_scanner);
+      }
    }
    else
    {
@@ -27,6 +27,7 @@ Changes
 
 #include <cio_streams.h>
 #include <clb_stringtrees.h>
+#include <clb_simple_stuff.h>
 #include <ctype.h>
 #include <limits.h>
 
@@ -123,6 +124,8 @@ typedef struct tokencell
    TokenType     tok;         /* Type for AcceptTok(), TestTok() ...   */
    DStr_p        literal;     /* Verbatim copy of input for the token  */
    unsigned long numval;      /* Numerical value (if any) of the token */
+   StrHashType   hash;        /* StrHash() of literal for identifiers
+                                 and strings (undefined otherwise)    */
    DStr_p        comment;     /* Accumulated preceding comments        */
    bool          skipped;     /* Was this token preceded by SkipSpace? */
    DStr_p        source;      /* Ref. to the input stream source       */
@@ -134,6 +137,42 @@ typedef struct tokencell
 
 #define MAXTOKENLOOKAHEAD 4
 
+
+/* A recorded sequence of real tokens of one input, ending with
+   NoToken. Tapes are filled ahead of parsing (possibly in another
+   thread, see cio_prefetch.h, or from the include cache, see
+   cio_includecache.h) and then replayed by the scanner instead of
+   reading characters.
+
+   Tokens are stored in a compact byte encoding: A head byte with the
+   bit number of the token type (TAPE_TOK_MASK), a flag for "same
+   literal as the previous token of this type" and the skipped flag,
+   followed by the position, the literal (length and bytes, unless
+   repeated), and for PosInt and Idnum the numerical value. Numbers
+   are unsigned LEB128. The position is 2*d for a token d columns
+   after the previous one on the same line, and 2*d+1 followed by
+   the column for a token d lines further down. Identifier hashes
+   are recomputed on replay. */
+
+#define TAPE_TOK_MASK     0x3f
+#define TAPE_SAME_LITERAL 0x40
+#define TAPE_SKIPPED      0x80
+#define TAPE_TOK_TYPES    64
+
+typedef struct token_tape_cell
+{
+   unsigned char *data;
+   long          start;    /* First byte of the first token */
+   long          len;      /* End of the encoded tokens */
+   long          size;     /* Size of data */
+   long          pos;      /* Next byte to replay */
+   long          line;     /* Position of the previous token */
+   long          column;
+   long          last_lit[TAPE_TOK_TYPES]; /* Last literal per type */
+   long          last_len[TAPE_TOK_TYPES];
+}TokenTapeCell, *TokenTape_p;
+
+
 typedef struct scannercell
 {
    Stream_p    source;  /* Input stack from which to read */
@@ -148,6 +187,7 @@ typedef struct scannercell
    TokenCell   tok_sequence[MAXTOKENLOOKAHEAD]; /* Need help? Bozo! */
    int         current; /* Pointer to current token in tok_sequence */
    char*       include_pos; /* If created by "include", by which one? */
+   TokenTape_p tape; /* If set, tokens are replayed from here */
 }ScannerCell, *Scanner_p;
 
 
@@ -159,6 +199,10 @@ typedef struct scannercell
 #define TokenCellFree(junk)   SizeFree(junk, sizeof(TokenCell))
 #define ScannerCellAlloc()    (ScannerCell*)SizeMalloc(sizeof(ScannerCell))
 #define ScannerCellFree(junk) SizeFree(junk, sizeof(ScannerCell))
+#define TokenTapeCellAlloc()    (TokenTapeCell*)SizeMalloc(sizeof(TokenTapeCell))
+#define TokenTapeCellFree(junk) SizeFree(junk, sizeof(TokenTapeCell))
+
+#define TokenTapeMem(tape) ((tape)->size)
 
 #define  Source(scanner)       (((scanner)->source)->source)
 #define  SourceType(scanner)   (((scanner)->source)->stream_type)
@@ -188,6 +232,12 @@ void      DestroyScanner(Scanner_p  junk);
 
 void      ScannerSetFormat(Scanner_p scanner, IOFormat fmt);
 
+TokenTape_p TokenTapeAlloc(void);
+void        TokenTapeFree(TokenTape_p junk);
+void        TokenTapeRewind(TokenTape_p tape);
+void        ScannerRecordTape(Scanner_p in, TokenTape_p tape);
+void        ScannerReplayTape(Scanner_p in, TokenTape_p tape);
+
 
 #define TOKENREALPOS(pos) ((pos) % MAXTOKENLOOKAHEAD)
 #define AktToken(in) (&((in)->tok_sequence[(in)->current]))
@@ -18,6 +18,10 @@ Changes
 
 <1> Sat Jul  5 02:28:25 MET DST 1997
     New
+<2> Mon Oct 19 18:02:40 CEST 2026
+    Map files into memory, read other input in blocks.
+<3> Mon Oct 19 23:59:51 CEST 2026
+    Read stdin through stdio.
 
 -----------------------------------------------------------------------*/
 
@@ -54,50 +58,151 @@ const StreamType StreamTypeOptionString =
 
 /*-----------------------------------------------------------------------
 //
-// Function: read_char()
+// Function: stream_read_stdio()
 //
-//   Read a character and return it. Return an infinite sequence of
-//   EOFs after the end of file.
+//   Read len characters from the FILE of stream into buf (fewer only
+//   at the end of the input). Return the number of characters read,
+//   0 at end of file.
 //
 // Global Variables: -
 //
-// Side Effects    : May read a character
+// Side Effects    : Reads input, may terminate with an error.
 //
 /----------------------------------------------------------------------*/
 
-static int read_char(Stream_p stream)
+static ssize_t stream_read_stdio(Stream_p stream, char* buf, size_t len)
 {
-   int ch;
+   size_t got;
 
-   if(stream->eof_seen)
+   while(true)
    {
-      ch = EOF;
+      got = fread(buf, 1, len, stream->file);
+      if(got || feof(stream->file))
+      {
+         return got;
+      }
+      if(errno != EINTR)
+      {
+         TmpErrno = errno;
+         SysError("Cannot read from %s", FILE_ERROR,
+                  DStrView(stream->source));
+      }
+      clearerr(stream->file);
    }
-   else
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: stream_refill()
+//
+//   Move the unread part of the block buffer to its start and read
+//   until at least MAXLOOKAHEAD characters are available or the
+//   input is exhausted. Note that read() returns whatever is
+//   available, so this does not block interactive input longer than
+//   necessary.
+//
+//   stdin may also be read through stdio by other parts of the
+//   program, so for it we go through its FILE and only read as much
+//   as the lookahead needs (as the character-wise reading always
+//   did). Other files are private to the stream and are read in
+//   blocks with read().
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, may terminate with an error.
+//
+/----------------------------------------------------------------------*/
+
+static void stream_refill(Stream_p stream)
+{
+   long    rest = StreamAvail(stream);
+   ssize_t got;
+
+   assert(!stream->mapped);
+   assert(stream->buf_size);
+
+   if(stream->pos)
    {
-      if(stream->stream_type!=StreamTypeFile)
+      memmove(stream->data, stream->data+stream->pos, rest);
+      stream->size = rest;
+      stream->pos  = 0;
+   }
+   while(!stream->eof_seen && StreamAvail(stream) < MAXLOOKAHEAD)
+   {
+      if(stream->file == stdin)
       {
-    ch = (int)DStrView(stream->source)[stream->string_pos];
-    if(ch)
-    {
-       stream->string_pos++;
-    }
-    else
-    {
-       ch = EOF;
-       stream->eof_seen = true;
-    }
+         got = stream_read_stdio(stream, stream->data+stream->size,
+                                 MAXLOOKAHEAD-StreamAvail(stream));
       }
       else
       {
-    ch = getc(stream->file);
-    if(ch == EOF)
-    {
-       stream->eof_seen = true;
-    }
+         got = read(fileno(stream->file), stream->data+stream->size,
+                    stream->buf_size-stream->size);
+      }
+      if(got > 0)
+      {
+         stream->size += got;
+      }
+      else if(got == 0)
+      {
+         stream->eof_seen = true;
+      }
+      else if(errno != EINTR)
+      {
+         TmpErrno = errno;
+         SysError("Cannot read from %s", FILE_ERROR,
+                  DStrView(stream->source));
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: stream_init_file()
+//
+//   Set up the input window for a freshly opened file stream: Map
+//   regular files (other than stdin, see stream_refill()) into
+//   memory, otherwise allocate a block buffer and fill it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, reads input
+//
+/----------------------------------------------------------------------*/
+
+static void stream_init_file(Stream_p stream)
+{
+   struct stat stat_buf;
+   int         fd = fileno(stream->file);
+   void*       map;
+
+   stream->pos    = 0;
+   stream->mapped = false;
+   if(stream->file != stdin &&
+      fstat(fd, &stat_buf) == 0 &&
+      S_ISREG(stat_buf.st_mode) &&
+      stat_buf.st_size > 0 &&
+      lseek(fd, 0, SEEK_CUR) == 0)
+   {
+      map = mmap(NULL, stat_buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(map != MAP_FAILED)
+      {
+         madvise(map, stat_buf.st_size, MADV_SEQUENTIAL);
+         stream->data     = map;
+         stream->size     = stat_buf.st_size;
+         stream->buf_size = 0;
+         stream->mapped   = true;
+         stream->eof_seen = true;
+         return;
       }
    }
-   return ch;
+   stream->buf_size = STREAM_BLOCK_SIZE;
+   stream->data     = SecureMalloc(STREAM_BLOCK_SIZE);
+   stream->size     = 0;
+   stream->eof_seen = false;
+   stream_refill(stream);
 }
 
 /*---------------------------------------------------------------------*/
@@ -121,7 +226,6 @@ static int read_char(Stream_p stream)
 Stream_p CreateStream(StreamType type, char* source, bool fail)
 {
    Stream_p handle;
-   int      i;
 
    handle = StreamCellAlloc();
 
@@ -150,24 +254,24 @@ Stream_p CreateStream(StreamType type, char* source, bool fail)
          }
       }
       VERBOUTARG("Opened ", DStrView(handle->source));
+      stream_init_file(handle);
    }
    else
    {
       /* Interprete source as a string to read from! */
 
       DStrSet(handle->source, source);
-      handle->string_pos = 0;
+      handle->file     = NULL;
+      handle->data     = DStrView(handle->source);
+      handle->size     = DStrLen(handle->source);
+      handle->pos      = 0;
+      handle->buf_size = 0;
+      handle->mapped   = false;
+      handle->eof_seen = true;
    }
    handle->next       = NULL;
-   handle->eof_seen   = false;
    handle->line       = 1;
    handle->column     = 1;
-   handle->current    = 0;
-
-   for(i=0; i<MAXLOOKAHEAD; i++)
-   {
-      handle->buffer[i] = read_char(handle);
-   }
 
    return handle;
 }
@@ -190,6 +294,14 @@ void DestroyStream(Stream_p stream)
 {
    if(stream->stream_type == StreamTypeFile)
    {
+      if(stream->mapped)
+      {
+         munmap(stream->data, stream->size);
+      }
+      else
+      {
+         FREE(stream->data);
+      }
       if(stream->file != stdin)
       {
     if(fclose(stream->file) != 0)
@@ -231,10 +343,53 @@ int StreamNextChar(Stream_p stream)
    {
       stream->column++;
    }
-   stream->current=STREAMREALPOS(stream->current+1);
-   stream->buffer[STREAMREALPOS(stream->current+MAXLOOKAHEAD-1)]
-      = read_char(stream);
+   if(stream->pos < stream->size)
+   {
+      stream->pos++;
+   }
+   if(!stream->eof_seen && StreamAvail(stream) < MAXLOOKAHEAD)
+   {
+      stream_refill(stream);
+   }
+   return StreamCurrChar(stream);
+}
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: StreamAdvance()
+//
+//   Move the current window count characters forward, where count
+//   must not exceed StreamAvail(stream). This is equivalent to
+//   count calls to StreamNextChar(), but only looks at each
+//   character once. Return the new CurrChar().
+//
+// Global Variables: -
+//
+// Side Effects    : As StreamNextChar()
+//
+/----------------------------------------------------------------------*/
+
+int StreamAdvance(Stream_p stream, long count)
+{
+   char *start = StreamCurrPtr(stream),
+        *end   = start+count,
+        *nl;
+
+   assert(count <= StreamAvail(stream));
+
+   stream->column += count;
+   while((nl = memchr(start, '\n', end-start)))
+   {
+      stream->line++;
+      stream->column = end-nl;
+      start = nl+1;
+   }
+   stream->pos += count;
+   if(!stream->eof_seen && StreamAvail(stream) < MAXLOOKAHEAD)
+   {
+      stream_refill(stream);
+   }
    return StreamCurrChar(stream);
 }
 
@@ -21,6 +21,9 @@ Changes
 
 <1> Wed Aug 20 00:02:32 MET DST 1997
     New
+<2> Mon Oct 19 18:02:40 CEST 2026
+    Contiguous input window (mmap or block reads) instead of a
+    character ring buffer.
 
 -----------------------------------------------------------------------*/
 
@@ -28,6 +31,9 @@ Changes
 
 #define CIO_STREAMS
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <cio_initio.h>
 #include <cio_fileops.h>
 
@@ -37,6 +43,10 @@ Changes
 
 #define MAXLOOKAHEAD 64
 
+/* Size of blocks read from input that cannot be mapped (pipes,
+   terminals). */
+#define STREAM_BLOCK_SIZE 65536
+
 
 /* Streams can read either from a file or from several predefined
    classes of strings. We use a StreamType 'virtual type' to denote
@@ -49,7 +59,16 @@ typedef char* StreamType;
 /* The following data structure describes the state of a (named) input
    stream with lookahead-capability. Streams are stackable, with new
    data being read from the top of the stack. The empty stack is a
-   NULL-valued pointer of type Inpstack_p! */
+   NULL-valued pointer of type Inpstack_p!
+
+   The input is presented as a contiguous window data[0..size-1]
+   with the current character at data[pos]. For regular files this
+   is the whole file mapped into memory, for strings it is the
+   string itself, and for other input it is a buffer that is
+   refilled in blocks and always holds at least MAXLOOKAHEAD
+   characters beyond pos (unless the input is exhausted). Callers
+   can thus consume runs of characters directly from the window
+   (see StreamCurrPtr() and StreamAdvance()). */
 
 
 typedef struct streamcell
@@ -58,13 +77,15 @@ typedef struct streamcell
    DStr_p             source;
    StreamType         stream_type; /* Only constant strings allowed
                   here! */
-   long               string_pos;
    FILE*              file;
-   bool               eof_seen;
+   bool               eof_seen;    /* All input is in data */
+   bool               mapped;      /* data is an mmap()ed file */
    long               line;
    long               column;
-   int                buffer[MAXLOOKAHEAD];
-   int                current;
+   char*              data;
+   long               size;        /* Characters in data */
+   long               pos;         /* Current character */
+   long               buf_size;    /* Size of block buffer, if any */
 }StreamCell, *Stream_p, **Inpstack_p;
 
 
@@ -84,16 +105,21 @@ extern const StreamType StreamTypeOptionString;
 Stream_p CreateStream(StreamType type, char* source, bool fail);
 void     DestroyStream(Stream_p stream);
 
-#define  STREAMREALPOS(pos) ((pos) % MAXLOOKAHEAD)
-
 #define  StreamLookChar(stream, look)\
          (assert((look)<MAXLOOKAHEAD),\
-     (stream)->buffer[STREAMREALPOS((stream)->current+(look))])
-#define  StreamCurrChar(stream) ((stream)->buffer[(stream)->current])
+          ((stream)->pos+(look) < (stream)->size)?\
+          (int)(unsigned char)(stream)->data[(stream)->pos+(look)]:EOF)
+#define  StreamCurrChar(stream) StreamLookChar((stream), 0)
 #define  StreamCurrLine(stream)   ((stream)->line)
 #define  StreamCurrColumn(stream) ((stream)->column)
 
+/* Direct access to the input window: StreamAvail() characters
+   starting at StreamCurrPtr() are valid. */
+#define  StreamCurrPtr(stream)  ((stream)->data+(stream)->pos)
+#define  StreamAvail(stream)    ((stream)->size-(stream)->pos)
+
 int      StreamNextChar(Stream_p stream);
+int      StreamAdvance(Stream_p stream, long count);
 
 Stream_p OpenStackedInput(Inpstack_p stack, StreamType type,
            char* source, bool fail);
@@ -189,6 +189,7 @@ int main(int argc, char* argv[])
             // all other errors indicate a more severe problem - no retry
             SysError("Unable to listen on socket %d", SYS_ERROR, oldsock);
          }
+         fflush(GlobalOut);
          if ((pid = fork()) == -1)
          {
             close(sock_fd);
@@ -81,12 +81,15 @@ typedef enum
    OPT_TSTP_PARSE,
    OPT_TSTP_PRINT,
    OPT_TSTP_FORMAT,
+   OPT_INCLUDE_THREADS,
+   OPT_INCLUDE_CACHE,
    OPT_AUTO,
    OPT_SATAUTO,
    OPT_AUTODEV,
    OPT_SATAUTODEV,
    OPT_AUTO_SCHED,
    OPT_SATAUTO_SCHED,
+   OPT_SCHEDULE_DB,
    OPT_NO_PREPROCESSING,
    OPT_EQ_UNFOLD_LIMIT,
    OPT_EQ_UNFOLD_MAXCLAUSES,
@@ -113,6 +116,7 @@ typedef enum
    OPT_FILTER_ORPHANS_LIMIT,
    OPT_FORWARD_CONTRACT_LIMIT,
    OPT_DELETE_BAD_LIMIT,
+   OPT_SPILL_BAD_CLAUSES,
    OPT_ASSUME_COMPLETENESS,
    OPT_ASSUME_INCOMPLETENESS,
    OPT_DISABLE_EQ_FACTORING,
@@ -587,6 +591,25 @@ OptCell opts[] =
     NoArg, NULL,
     "Synonymous with --tstp-format."},
 
+   {OPT_INCLUDE_THREADS,
+    '\0', "include-threads",
+    ReqArg, NULL,
+    "Read the files named by a sequence of consecutive TPTP include "
+    "statements ahead of parsing, using up to the given number of "
+    "threads to tokenize them in parallel. The files are still parsed "
+    "in order, so the result is the same as without this option. "
+    "0 (the default) reads included files one by one."},
+
+   {OPT_INCLUDE_CACHE,
+    '\0', "include-cache",
+    ReqArg, NULL,
+    "Keep tokenized copies of TPTP include files in the given directory "
+    "(which is created if necessary) and use them instead of reading "
+    "and scanning files again that have not changed since. Entries are "
+    "checked against the size, modification time and (if the time "
+    "differs) the content hash of the file. Parsing is not affected, "
+    "so the result is the same as without this option."},
+
    {OPT_AUTO,
     '\0', "auto",
     NoArg, NULL,
@@ -625,6 +648,16 @@ OptCell opts[] =
     "Use the (experimental) strategy scheduling without SInE, thus "
     "maintaining completeness."},
 
+   {OPT_SCHEDULE_DB,
+    '\0', "schedule-db",
+    ReqArg, NULL,
+    "Use the named file as a local database of strategy performance for "
+    "strategy scheduling. Strategies that did well on earlier problems "
+    "of the same class are tried first and get more time, and the "
+    "results of this run are added to the file (which is created if "
+    "necessary). Only used together with --auto-schedule or "
+    "--satauto-schedule."},
+
    {OPT_NO_PREPROCESSING,
     '\0', "no-preprocessing",
     NoArg, NULL,
@@ -829,6 +862,16 @@ OptCell opts[] =
     " memory limit, the prover will determine a good value"
     " automatically."},
 
+   {OPT_SPILL_BAD_CLAUSES,
+    '\0', "spill-bad-clauses",
+    NoArg, NULL,
+    "When the limit set with --delete-bad-limit is reached, write the "
+    "bad unprocessed clauses to temporary files (in $TMPDIR) instead of "
+    "deleting them. Only their evaluations are kept in memory. "
+    "Spilled clauses are read back and simplified when the unprocessed "
+    "clause set runs empty, so that the prover stays complete (as long "
+    "as the clauses are untyped)."},
+
    {OPT_ASSUME_COMPLETENESS,
     '\0', "assume-completeness",
     NoArg, NULL,
@@ -0,0 +1,887 @@
+/*-----------------------------------------------------------------------
+
+File  : eheurbench.c
+
+Author: agent
+
+Contents
+
+  Read a specification (typically a clause set dumped from a real
+  run with eprover --print-saturated) and measure the throughput
+  and allocation behaviour of the heuristic functions (clause
+  weight functions and literal selection functions) on its clauses.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 11:03:27 CEST 2026
+    New
+<2> Mon Oct 19 17:10:05 CEST 2026
+    Added weight functions and allocation counts
+<3> Mon Oct 19 23:48:12 CEST 2026
+    Compare against the original selection functions (eheurbench_ref)
+<4> Mon Oct 19 23:59:40 CEST 2026
+    Allocation counts only with CLB_MEMORY_COUNT
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <cio_signals.h>
+#include <ccl_formulafunc.h>
+#include <che_clausesetfeatures.h>
+#include <che_litselection.h>
+#include <che_to_autoselect.h>
+#include <che_wfcbadmin.h>
+#include <e_version.h>
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#ifdef LITSEL_NO_FEATURES
+#define NAME "eheurbench_ref"
+#else
+#define NAME "eheurbench"
+#endif
+
+/* MemAllocCount only exists in builds with CLB_MEMORY_COUNT (see
+   "make bench_config"). Otherwise all allocation counts are 0. */
+
+#ifdef CLB_MEMORY_COUNT
+#define ALLOC_COUNT MemAllocCount
+#else
+#define ALLOC_COUNT 0
+#endif
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_OUTPUT,
+   OPT_ROUNDS,
+   OPT_LITSEL,
+   OPT_WEIGHTFUN,
+   OPT_NO_LITSEL,
+   OPT_NO_WEIGHTFUN,
+   OPT_REFERENCE,
+   OPT_LOP_PARSE,
+   OPT_TPTP_PARSE,
+   OPT_TSTP_PARSE
+}OptionCodes;
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    '\0', "version",
+    NoArg, NULL,
+    "Print the version number of the program."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program."},
+
+   {OPT_OUTPUT,
+    'o', "output-file",
+    ReqArg, NULL,
+    "Redirect output into the named file."},
+
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Apply each heuristic function this many times to each clause "
+    "(default 100)."},
+
+   {OPT_LITSEL,
+    'W', "literal-selection-strategy",
+    ReqArg, NULL,
+    "Only benchmark the named literal selection function (default: "
+    "all of them)."},
+
+   {OPT_WEIGHTFUN,
+    'w', "weight-function",
+    ReqArg, NULL,
+    "Only benchmark the given weight function, specified as in a "
+    "heuristic definition, e.g. 'Refinedweight(PreferGoals,2,1,1.5,"
+    "1.1,1)' (default: all weight functions with the parameters "
+    "from the built-in table)."},
+
+   {OPT_NO_LITSEL,
+    '\0', "no-literal-selection",
+    NoArg, NULL,
+    "Do not benchmark literal selection functions."},
+
+   {OPT_NO_WEIGHTFUN,
+    '\0', "no-weight-functions",
+    NoArg, NULL,
+    "Do not benchmark weight functions."},
+
+   {OPT_REFERENCE,
+    '\0', "reference",
+    ReqArg, NULL,
+    "Read the literal selection results of eheurbench_ref (the "
+    "original selection functions, without the literal feature "
+    "cache) on the same input and rounds from the named file. Print "
+    "the reference times and speedups, and fail if any selection "
+    "function selects different literals than its reference."},
+
+   {OPT_LOP_PARSE,
+    '\0', "lop-in",
+    NoArg, NULL,
+    "Set E-LOP as the input format."},
+
+   {OPT_TPTP_PARSE,
+    '\0', "tptp-in",
+    NoArg, NULL,
+    "Parse TPTP-2 format instead of E-LOP."},
+
+   {OPT_TSTP_PARSE,
+    '\0', "tstp-in",
+    NoArg, NULL,
+    "Parse TPTP-3 format instead of E-LOP."},
+
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+char     *outname    = NULL,
+         *refname    = NULL,
+         *litsel     = NULL,
+         *weightfun  = NULL;
+bool     bench_litsel = true,
+         bench_wfuns  = true;
+IOFormat parse_format = AutoFormat;
+long     rounds       = 100;
+
+/* Parameters for benchmarking the weight functions registered in
+   che_wfcbadmin.c. Functions without an entry (the TSM weights need
+   a knowledge base) are skipped unless given with -w. */
+
+static char* default_weight_funs[] =
+{
+   "Clauseweight(ConstPrio,2,1,1)",
+   "ClauseLMaxWeight(ConstPrio,2,1,1)",
+   "ClauseCMaxWeight(ConstPrio,2,1,1)",
+   "Uniqweight(ConstPrio)",
+   "Defaultweight(ConstPrio)",
+   "Refinedweight(ConstPrio,2,1,1.5,1.1,1)",
+   "Refinedweight2(ConstPrio,2,1,1.5,1.1,1)",
+   "PNRefinedweight(ConstPrio,1,1,1,2,2,2,0.5)",
+   "TPTPTypeweight(ConstPrio,2,1,1.5,1.1,1,1,1)",
+   "Sigweight(ConstPrio,2,1,1.5,1.1,1,1)",
+   "NLweight(ConstPrio,2,1,1,1.5,1.1,1)",
+   "SymbolTypeweight(ConstPrio,2,1,1,1,1.5,1.1,1)",
+   "Depthweight(ConstPrio,2,1,1.5,1.1,1,1)",
+   "WLessDWeight(ConstPrio,2,1,1.5,1.1,1,1)",
+   "Proofweight(ConstPrio,2,1,1.5,1.1,1,1,1)",
+   "Orientweight(ConstPrio,2,1,1.5,1.1,1)",
+   "OrientLMaxWeight(ConstPrio,2,1,2,1,1)",
+   "Simweight(ConstPrio,1,1,1,1)",
+   "FIFOWeight(ConstPrio)",
+   "LIFOWeight(ConstPrio)",
+   "StaggeredWeight(ConstPrio,1)",
+   "ClauseWeightAge(ConstPrio,1,1,1,3)",
+   "ConjectureSymbolWeight(ConstPrio,10,10,5,5,5,1.5,1.5,1)",
+   "ConjectureGeneralSymbolWeight(ConstPrio,1,1,1,3,3,3,0,1,1,1)",
+   "ConjectureRelativeSymbolWeight(ConstPrio,0.1,100,100,100,100,"
+   "1.5,1.5,1)",
+   "RelevanceLevelWeight(ConstPrio,2,2,0,2,100,100,100,100,1.5,1.5,1)",
+   "RelevanceLevelWeight2(ConstPrio,1,2,2,2,100,100,100,300,"
+   "1.5,1.5,1.5)",
+   "FunWeight(ConstPrio,2,1,1.5,1.1,1)",
+   "SymOffsetWeight(ConstPrio,2,1,1.5,1.1,1)",
+   NULL
+};
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: time_selection()
+//
+//   Apply fun rounds times to every clause on clauses (resetting
+//   selection and orientation as DoLiteralSelection() does, and the
+//   pseudo-random counter once at the start) and return the CPU time
+//   used in microseconds. The number of memory blocks allocated is
+//   added to *allocs.
+//
+// Global Variables: MemAllocCount
+//
+// Side Effects    : Changes literal properties, fills the literal
+//                   feature caches.
+//
+/----------------------------------------------------------------------*/
+
+static long long time_selection(LiteralSelectionFun fun, OCB_p ocb,
+                                PStack_p clauses, long rounds,
+                                unsigned long *allocs)
+{
+   unsigned long start_allocs = ALLOC_COUNT;
+   long long start = GetUSecClock(), res;
+   PStackPointer i;
+   Clause_p clause;
+   long r;
+
+   LitSelResetCounter();
+   for(r=0; r<rounds; r++)
+   {
+      for(i=0; i<PStackGetSP(clauses); i++)
+      {
+         clause = PStackElementP(clauses, i);
+         EqnListDelProp(clause->literals, EPIsSelected);
+         ClauseDelProp(clause, CPIsOriented);
+         fun(ocb, clause);
+      }
+   }
+   res = GetUSecClock()-start;
+   *allocs += ALLOC_COUNT-start_allocs;
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: time_weight()
+//
+//   Evaluate all clauses on clauses rounds times with wfcb and return
+//   the CPU time used in microseconds. The number of memory blocks
+//   allocated is added to *allocs.
+//
+// Global Variables: MemAllocCount
+//
+// Side Effects    : Whatever the weight function does (e.g. marking
+//                   maximal terms)
+//
+/----------------------------------------------------------------------*/
+
+static long long time_weight(WFCB_p wfcb, PStack_p clauses, long rounds,
+                             unsigned long *allocs)
+{
+   unsigned long start_allocs = ALLOC_COUNT;
+   long long start = GetUSecClock(), res;
+   PStackPointer i;
+   volatile double sink = 0.0;
+   long r;
+
+   for(r=0; r<rounds; r++)
+   {
+      for(i=0; i<PStackGetSP(clauses); i++)
+      {
+         sink += wfcb->wfcb_eval(wfcb->data, PStackElementP(clauses, i));
+      }
+   }
+   res = GetUSecClock()-start;
+   *allocs += ALLOC_COUNT-start_allocs;
+   (void)sink;
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: selection_digest()
+//
+//   Return a hash of the positions of the literals currently
+//   selected in the clauses on clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static StrHashType selection_digest(PStack_p clauses)
+{
+   StrHashType   res = STR_HASH_INIT;
+   PStackPointer i;
+   Clause_p      clause;
+   Eqn_p         handle;
+   long          pos;
+
+   for(i=0; i<PStackGetSP(clauses); i++)
+   {
+      clause = PStackElementP(clauses, i);
+      for(handle=clause->literals, pos=0; handle;
+          handle=handle->next, pos++)
+      {
+         if(EqnIsSelected(handle))
+         {
+            res = (res^(StrHashType)pos)*STR_HASH_PRIME;
+         }
+      }
+      res = (res^(StrHashType)-1)*STR_HASH_PRIME;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: read_reference()
+//
+//   Read the selection results printed by eheurbench_ref from the
+//   named file into a tree indexed by function name. val1 is the
+//   time per clause in picoseconds, val2 the selection digest.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, IO
+//
+/----------------------------------------------------------------------*/
+
+static StrTree_p read_reference(char* name)
+{
+   FILE        *in = InputOpen(name, true);
+   StrTree_p   res = NULL;
+   char        line[256], fun[128];
+   double      time, allocs;
+   StrHashType digest;
+   IntOrP      val1, val2;
+
+   while(fgets(line, 256, in))
+   {
+      if(line[0] == '#')
+      {
+         continue;
+      }
+      if(sscanf(line, "%127s : %lf : %lf : %" SCNx64,
+                fun, &time, &allocs, &digest) != 4)
+      {
+         Error("%s: Cannot parse reference line %s", INPUT_SEMANTIC_ERROR,
+               name, line);
+      }
+      val1.i_val = time*1000.0;
+      val2.i_val = (long)digest;
+      StrTreeStore(&res, fun, val1, val2);
+   }
+   InputClose(in);
+   return res;
+}
+
+
+#ifdef LITSEL_NO_FEATURES
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_selection()
+//
+//   Benchmark a single literal selection function in its original
+//   form (computing all literal properties directly) and print a
+//   result line, including a digest of the selected literals.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, see time_selection().
+//
+/----------------------------------------------------------------------*/
+
+static void bench_selection(char* name, OCB_p ocb, PStack_p clauses,
+                            long rounds, StrTree_p *reference)
+{
+   LiteralSelectionFun fun = GetLitSelFun(name);
+   long long time;
+   double    calls = (double)rounds*PStackGetSP(clauses);
+   unsigned long allocs = 0, dummy = 0;
+
+   UNUSED(reference);
+   if(!fun)
+   {
+      Error("Unknown literal selection function %s", USAGE_ERROR, name);
+   }
+   time_selection(fun, ocb, clauses, 1, &dummy); /* Warm up */
+   time = time_selection(fun, ocb, clauses, rounds, &allocs);
+
+   fprintf(GlobalOut, "%-40s : %10.1f : %8.2f : %016" PRIx64 "\n",
+           name,
+           time*1000.0/calls,
+           allocs/calls,
+           selection_digest(clauses));
+}
+
+#else
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_selection()
+//
+//   Benchmark a single literal selection function with the literal
+//   feature cache disabled (features recomputed on every call) and
+//   enabled, and print a result line. If reference has an entry for
+//   the function (see read_reference()), also print the time of the
+//   original implementation and the speedup over it. It is an error
+//   if the function selects different literals with and without the
+//   cache, or differently from the reference.
+//
+// Global Variables: LitFeaturesCaching
+//
+// Side Effects    : Output, see time_selection().
+//
+/----------------------------------------------------------------------*/
+
+static void bench_selection(char* name, OCB_p ocb, PStack_p clauses,
+                            long rounds, StrTree_p *reference)
+{
+   LiteralSelectionFun fun = GetLitSelFun(name);
+   long long   plain, cached;
+   double      calls = (double)rounds*PStackGetSP(clauses), ref_time;
+   unsigned long plain_allocs = 0, cached_allocs = 0, dummy = 0;
+   StrHashType plain_digest, cached_digest;
+   StrTree_p   ref = StrTreeFind(reference, name);
+   char        ref_str[16], ratio_str[16];
+
+   if(!fun)
+   {
+      Error("Unknown literal selection function %s", USAGE_ERROR, name);
+   }
+   LitFeaturesCaching = false;
+   time_selection(fun, ocb, clauses, 1, &dummy); /* Warm up */
+   plain  = time_selection(fun, ocb, clauses, rounds, &plain_allocs);
+   plain_digest = selection_digest(clauses);
+   LitFeaturesCaching = true;
+   cached = time_selection(fun, ocb, clauses, rounds, &cached_allocs);
+   cached_digest = selection_digest(clauses);
+
+   if(plain_digest != cached_digest)
+   {
+      Error("%s selects different literals with and without the "
+            "literal feature cache", OTHER_ERROR, name);
+   }
+   if(ref && (StrHashType)ref->val2.i_val != cached_digest)
+   {
+      Error("%s selects different literals than the reference "
+            "implementation", OTHER_ERROR, name);
+   }
+   if(ref)
+   {
+      ref_time = ref->val1.i_val/1000.0;
+      snprintf(ref_str, 16, "%10.1f", ref_time);
+      snprintf(ratio_str, 16, "%6.2f",
+               cached?ref_time*calls/(cached*1000.0):0.0);
+   }
+   else
+   {
+      snprintf(ref_str, 16, "%10s", "-");
+      snprintf(ratio_str, 16, "%6s", "-");
+   }
+   fprintf(GlobalOut,
+           "%-40s : %s : %10.1f : %10.1f : %s : %8.2f : %8.2f\n",
+           name,
+           ref_str,
+           plain*1000.0/calls,
+           cached*1000.0/calls,
+           ratio_str,
+           plain_allocs/calls,
+           cached_allocs/calls);
+}
+
+#endif
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_weight()
+//
+//   Parse the weight function spec, benchmark it on clauses, and
+//   print a result line.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, memory operations, see time_weight().
+//
+/----------------------------------------------------------------------*/
+
+static void bench_weight(char* spec, OCB_p ocb, ProofState_p state,
+                         PStack_p clauses, long rounds)
+{
+   Scanner_p     in;
+   WFCB_p        wfcb;
+   long long     time;
+   unsigned long allocs = 0, dummy = 0;
+   double        calls = (double)rounds*PStackGetSP(clauses);
+   char          name[41];
+
+   in = CreateScanner(StreamTypeOptionString, spec, true, NULL);
+   wfcb = WeightFunParse(in, ocb, state);
+   CheckInpTok(in, NoToken);
+   DestroyScanner(in);
+
+   time_weight(wfcb, clauses, 1, &dummy); /* Warm up, lazy init */
+   time = time_weight(wfcb, clauses, rounds, &allocs);
+
+   strncpy(name, spec, 40);
+   name[40] = '\0';
+   name[strcspn(name, "(")] = '\0';
+   fprintf(GlobalOut, "%-40s : %10.1f : %8.2f\n",
+           name,
+           time*1000.0/calls,
+           allocs/calls);
+   WFCBFree(wfcb);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_all_weights()
+//
+//   Benchmark all weight functions known to che_wfcbadmin.c for which
+//   default_weight_funs[] has parameters.
+//
+// Global Variables: WeightFunParseFunNames, default_weight_funs
+//
+// Side Effects    : Output, see bench_weight().
+//
+/----------------------------------------------------------------------*/
+
+static void bench_all_weights(OCB_p ocb, ProofState_p state,
+                              PStack_p clauses, long rounds)
+{
+   int    i, j;
+   size_t len;
+
+   for(i=0; WeightFunParseFunNames[i]; i++)
+   {
+      len = strlen(WeightFunParseFunNames[i]);
+      for(j=0; default_weight_funs[j]; j++)
+      {
+         if(strncmp(default_weight_funs[j],
+                    WeightFunParseFunNames[i], len)==0 &&
+            default_weight_funs[j][len] == '(')
+         {
+            break;
+         }
+      }
+      if(default_weight_funs[j])
+      {
+         bench_weight(default_weight_funs[j], ocb, state, clauses,
+                      rounds);
+      }
+      else
+      {
+         fprintf(GlobalOut, "%-40s : %10s : %8s\n",
+                 WeightFunParseFunNames[i], "skipped", "-");
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: main()
+//
+//   The main function and entry point of the program.
+//
+// Global Variables: -
+//
+// Side Effects    : Yes ;-)
+//
+/----------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+   ProofState_p    fstate;
+   HeuristicParms_p h_parms;
+   SpecFeatureCell features;
+   OCB_p           ocb;
+   Scanner_p       in;
+   int             i;
+   CLState_p       state;
+   StrTree_p       skip_includes = NULL;
+   PStack_p        clauses, sel_clauses;
+   Clause_p        handle;
+   DStr_p          names;
+   char            *name, *next;
+   StrTree_p       reference = NULL;
+
+   assert(argv[0]);
+#ifdef STACK_SIZE
+   INCREASE_STACK_SIZE;
+#endif
+   InitIO(NAME);
+   ESignalSetup(SIGXCPU);
+
+   state = process_options(argc, argv);
+
+   OpenGlobalOut(outname);
+
+   if(state->argc ==  0)
+   {
+      CLStateInsertArg(state, "-");
+   }
+
+   fstate = ProofStateAlloc(FPIgnoreProps);
+   for(i=0; state->argv[i]; i++)
+   {
+      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
+      ScannerSetFormat(in, parse_format);
+      FormulaAndClauseSetParse(in, fstate->f_axioms, fstate->watchlist,
+                               fstate->terms, NULL, &skip_includes);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+   CLStateFree(state);
+
+   FormulaSetPreprocConjectures(fstate->f_axioms, fstate->f_ax_archive,
+                                false, false);
+   FormulaSetCNF2(fstate->f_axioms, fstate->f_ax_archive,
+                  fstate->axioms, fstate->terms, fstate->freshvars,
+                  fstate->gc_terms, 1000);
+
+#ifndef CLB_MEMORY_COUNT
+   fprintf(GlobalOut, "# Allocations are not counted in this build "
+           "(use make bench_config)\n");
+#endif
+   h_parms = HeuristicParmsAlloc();
+   SpecFeaturesCompute(&features, fstate->axioms, fstate->signature);
+   ocb = TOSelectOrdering(fstate, h_parms, &features);
+
+   clauses     = PStackAlloc();
+   sel_clauses = PStackAlloc();
+   for(handle = fstate->axioms->anchor->succ;
+       handle != fstate->axioms->anchor;
+       handle = handle->succ)
+   {
+      PStackPushP(clauses, handle);
+      if(handle->neg_lit_no)
+      {
+         PStackPushP(sel_clauses, handle);
+      }
+   }
+
+   if(bench_wfuns)
+   {
+      fprintf(GlobalOut, "# %ld clauses, %ld rounds\n",
+              (long)PStackGetSP(clauses), rounds);
+      fprintf(GlobalOut, "# %-38s : %10s : %8s\n",
+              "Weight function", "ns/clause", "allocs");
+      if(PStackEmpty(clauses))
+      {
+         /* Nothing to do */
+      }
+      else if(weightfun)
+      {
+         bench_weight(weightfun, ocb, fstate, clauses, rounds);
+      }
+      else
+      {
+         bench_all_weights(ocb, fstate, clauses, rounds);
+      }
+   }
+
+   if(bench_litsel)
+   {
+      if(refname)
+      {
+         reference = read_reference(refname);
+      }
+      fprintf(GlobalOut, "# %ld clauses with negative literals, %ld rounds\n",
+              (long)PStackGetSP(sel_clauses), rounds);
+#ifdef LITSEL_NO_FEATURES
+      fprintf(GlobalOut, "# %-38s : %10s : %8s : %16s\n",
+              "Literal selection", "ns/clause", "allocs", "digest");
+#else
+      fprintf(GlobalOut, "# %-38s : %10s : %10s : %10s : %6s : %8s : %8s\n",
+              "Literal selection", "ns/ref", "ns/clause", "ns/cached",
+              "ratio", "allocs", "allocs/c");
+#endif
+
+      if(PStackEmpty(sel_clauses))
+      {
+         /* Nothing to do */
+      }
+      else if(litsel)
+      {
+         bench_selection(litsel, ocb, sel_clauses, rounds, &reference);
+      }
+      else
+      {
+         names = DStrAlloc();
+         LitSelAppendNames(names);
+         name = DStrCopy(names);
+         for(next = strtok(name, ", "); next; next = strtok(NULL, ", "))
+         {
+            bench_selection(next, ocb, sel_clauses, rounds, &reference);
+         }
+         FREE(name);
+         DStrFree(names);
+      }
+#ifndef LITSEL_NO_FEATURES
+      fprintf(GlobalOut, "# Literal features computed: %ld, reused: %ld\n",
+              LitFeaturesComputed, LitFeaturesReused);
+#endif
+      StrTreeFree(reference);
+   }
+
+   PStackFree(sel_clauses);
+   PStackFree(clauses);
+   OCBFree(ocb);
+   HeuristicParmsFree(h_parms);
+#ifndef FAST_EXIT
+   ProofStateFree(fstate);
+#endif
+
+   fflush(GlobalOut);
+   OutClose(GlobalOut);
+   ExitIO();
+
+#ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+#endif
+
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, rounds, litsel, weightfun,
+//                   bench_litsel, bench_wfuns, refname, parse_format
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            printf(NAME " " VERSION "\n");
+            exit(NO_ERROR);
+      case OPT_OUTPUT:
+            outname = arg;
+            break;
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArg(handle, arg);
+            if(rounds < 1)
+            {
+               Error("Option -r (--rounds) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            break;
+      case OPT_LITSEL:
+            litsel = arg;
+            break;
+      case OPT_WEIGHTFUN:
+            weightfun = arg;
+            break;
+      case OPT_NO_LITSEL:
+            bench_litsel = false;
+            break;
+      case OPT_NO_WEIGHTFUN:
+            bench_wfuns = false;
+            break;
+      case OPT_REFERENCE:
+            refname = arg;
+            break;
+      case OPT_LOP_PARSE:
+            parse_format = LOPFormat;
+            break;
+      case OPT_TPTP_PARSE:
+            parse_format = TPTPFormat;
+            break;
+      case OPT_TSTP_PARSE:
+            parse_format = TSTPFormat;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+" NAME " " VERSION "\n\
+\n\
+Usage: " NAME " [options] [files]\n\
+\n\
+Read a specification, convert it to clause normal form, and\n\
+measure the time the heuristic functions take per clause. To get\n\
+a realistic clause population, use a dump of the clause sets of a\n\
+real run, e.g. the output of\n\
+\n\
+  eprover --print-saturated --tstp-format --output-level=0 ...\n\
+\n\
+For each weight function, the average time and the average number\n\
+of memory blocks allocated per evaluation are printed. For each\n\
+literal selection function, the same numbers are printed with the\n\
+literal feature cache disabled and enabled. Allocations are only\n\
+counted if E was built after \"make bench_config\", otherwise they\n\
+are reported as 0.\n\
+\n\
+eheurbench_ref is built from the same sources, but with the\n\
+original selection functions that compute all literal properties\n\
+directly. It prints one time and a digest of the selected literals\n\
+per function. To compare both, run\n\
+\n\
+  eheurbench_ref -o ref.txt --no-weight-functions spec\n\
+  eheurbench --reference=ref.txt --no-weight-functions spec\n\
+\n\
+with the same -r and -W options. eheurbench fails if a function\n\
+selects different literals with and without the cache, or\n\
+differently from the reference.\n\
+\n");
+   PrintOptions(stdout, opts, "Options:\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
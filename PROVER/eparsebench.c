@@ -0,0 +1,439 @@
+/*-----------------------------------------------------------------------
+
+File  : eparsebench.c
+
+Author: agent
+
+Contents
+
+  Measure the throughput of the scanner and the parser on (large)
+  input files.
+
+  Copyright 2026 by agent.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 18:40:12 CEST 2026
+    New
+<2> Mon Oct 19 21:40:03 CEST 2026
+    Added --include-threads
+<3> Mon Oct 19 23:05:17 CEST 2026
+    Added --include-cache
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <cio_signals.h>
+#include <ccl_formulafunc.h>
+#include <ccl_proofstate.h>
+#include <e_version.h>
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#define NAME "eparsebench"
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_OUTPUT,
+   OPT_ROUNDS,
+   OPT_SCAN_ONLY,
+   OPT_INCLUDE_THREADS,
+   OPT_INCLUDE_CACHE,
+   OPT_LOP_PARSE,
+   OPT_TPTP_PARSE,
+   OPT_TSTP_PARSE
+}OptionCodes;
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    '\0', "version",
+    NoArg, NULL,
+    "Print the version number of the program."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program."},
+
+   {OPT_OUTPUT,
+    'o', "output-file",
+    ReqArg, NULL,
+    "Redirect output into the named file."},
+
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Read each file this many times (default 3)."},
+
+   {OPT_SCAN_ONLY,
+    '\0', "scan-only",
+    NoArg, NULL,
+    "Only measure the scanner (tokenization), do not parse."},
+
+   {OPT_INCLUDE_THREADS,
+    'j', "include-threads",
+    ReqArg, NULL,
+    "Tokenize consecutive included files in parallel with up to this "
+    "many threads (default 0, i.e. read them one by one)."},
+
+   {OPT_INCLUDE_CACHE,
+    '\0', "include-cache",
+    ReqArg, NULL,
+    "Use the given directory as a cache of tokenized files. The first "
+    "round fills the cache, later rounds (of scanning the named files "
+    "and parsing their includes) read from it."},
+
+   {OPT_LOP_PARSE,
+    '\0', "lop-in",
+    NoArg, NULL,
+    "Set E-LOP as the input format."},
+
+   {OPT_TPTP_PARSE,
+    '\0', "tptp-in",
+    NoArg, NULL,
+    "Parse TPTP-2 format instead of E-LOP."},
+
+   {OPT_TSTP_PARSE,
+    '\0', "tstp-in",
+    NoArg, NULL,
+    "Parse TPTP-3 format instead of E-LOP."},
+
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+char     *outname     = NULL;
+bool     scan_only    = false;
+IOFormat parse_format = AutoFormat;
+long     rounds       = 3;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: file_size()
+//
+//   Return the size of the named file, or 0 if it cannot be
+//   determined.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long file_size(char* name)
+{
+   struct stat stat_buf;
+
+   if(stat(name, &stat_buf) == 0)
+   {
+      return stat_buf.st_size;
+   }
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: time_scan()
+//
+//   Tokenize the file (without following includes) and return the
+//   time taken in microseconds. The number of tokens is stored in
+//   *tokens. With an include cache, the tokens are taken from (or
+//   first added to) the cache.
+//
+// Global Variables: IncludeCacheDir
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static long long time_scan(char* name, long *tokens)
+{
+   long long start = GetUSecClock();
+   Scanner_p in;
+
+   *tokens = 0;
+   in = CreateScanner(StreamTypeFile, name, true, NULL);
+   ScannerSetFormat(in, parse_format);
+   if(IncludeCacheDir && ScannerCacheable(in) && !IncludeCacheLoad(in))
+   {
+      IncludeCacheRecord(in);
+   }
+   while(!TestInpTok(in, NoToken))
+   {
+      NextToken(in);
+      (*tokens)++;
+   }
+   DestroyScanner(in);
+
+   return GetUSecClock()-start;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: time_parse()
+//
+//   Parse the file (including all includes) into a fresh proof state
+//   and return the time taken in microseconds. The number of
+//   formulas and clauses read is stored in *items.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long long time_parse(char* name, long *items)
+{
+   long long    start = GetUSecClock(), res;
+   ProofState_p state = ProofStateAlloc(FPIgnoreProps);
+   StrTree_p    skip_includes = NULL;
+   Scanner_p    in;
+
+   in = CreateScanner(StreamTypeFile, name, true, NULL);
+   ScannerSetFormat(in, parse_format);
+   *items = FormulaAndClauseSetParse(in, state->f_axioms, state->watchlist,
+                                     state->terms, NULL, &skip_includes);
+   CheckInpTok(in, NoToken);
+   DestroyScanner(in);
+   res = GetUSecClock()-start;
+
+   StrTreeFree(skip_includes);
+   ProofStateFree(state);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: print_result()
+//
+//   Print a result line for the best (smallest) of the measured
+//   times.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void print_result(char* name, char* what, long size, long count,
+                         long long usec)
+{
+   fprintf(GlobalOut, "%-30s : %-6s : %12ld : %10ld : %10.3f : %8.2f\n",
+           name, what, size, count, usec/1000000.0,
+           usec?(size/(double)usec):0.0);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: main()
+//
+//   The main function and entry point of the program.
+//
+// Global Variables: -
+//
+// Side Effects    : Yes ;-)
+//
+/----------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+   CLState_p state;
+   int       i;
+   long      r, size, count = 0;
+   long long time, best;
+
+   assert(argv[0]);
+#ifdef STACK_SIZE
+   INCREASE_STACK_SIZE;
+#endif
+   InitIO(NAME);
+   ESignalSetup(SIGXCPU);
+
+   state = process_options(argc, argv);
+
+   OpenGlobalOut(outname);
+
+   if(state->argc ==  0)
+   {
+      Error("No input files given", USAGE_ERROR);
+   }
+   fprintf(GlobalOut, "# Best of %ld rounds\n", rounds);
+   fprintf(GlobalOut, "# %-28s : %-6s : %12s : %10s : %10s : %8s\n",
+           "File", "Phase", "Bytes", "Items", "Seconds", "MB/s");
+
+   for(i=0; state->argv[i]; i++)
+   {
+      size = file_size(state->argv[i]);
+
+      best = LLONG_MAX;
+      for(r=0; r<rounds; r++)
+      {
+         time = time_scan(state->argv[i], &count);
+         best = MIN(best, time);
+      }
+      print_result(state->argv[i], "scan", size, count, best);
+
+      if(!scan_only)
+      {
+         best = LLONG_MAX;
+         for(r=0; r<rounds; r++)
+         {
+            time = time_parse(state->argv[i], &count);
+            best = MIN(best, time);
+         }
+         print_result(state->argv[i], "parse", size, count, best);
+      }
+   }
+   CLStateFree(state);
+
+   fflush(GlobalOut);
+   OutClose(GlobalOut);
+   ExitIO();
+
+#ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+#endif
+
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, rounds, scan_only, parse_format,
+//                   IncludePrefetchThreads, IncludeCacheDir
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            printf(NAME " " VERSION "\n");
+            exit(NO_ERROR);
+      case OPT_OUTPUT:
+            outname = arg;
+            break;
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArg(handle, arg);
+            if(rounds < 1)
+            {
+               Error("Option -r (--rounds) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            break;
+      case OPT_SCAN_ONLY:
+            scan_only = true;
+            break;
+      case OPT_INCLUDE_THREADS:
+            IncludePrefetchThreads =
+               CLStateGetIntArgCheckRange(handle, arg, 0, 1024);
+            break;
+      case OPT_INCLUDE_CACHE:
+            IncludeCacheDir = arg;
+            break;
+      case OPT_LOP_PARSE:
+            parse_format = LOPFormat;
+            break;
+      case OPT_TPTP_PARSE:
+            parse_format = TPTPFormat;
+            break;
+      case OPT_TSTP_PARSE:
+            parse_format = TSTPFormat;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+" NAME " " VERSION "\n\
+\n\
+Usage: " NAME " [options] files\n\
+\n\
+Read each file several times and report the best time and the\n\
+throughput (in MB/s, based on the size of the named file) of\n\
+tokenizing it, and of parsing it (including all includes) into\n\
+formulas and clauses.\n\
+\n");
+   PrintOptions(stdout, opts, "Options:\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -94,6 +94,7 @@ char              *outdesc = DEFAULT_OUTPUT_DESCRIPTOR,
    *filterdesc = DEFAULT_FILTER_DESCRIPTOR;
 PStack_p          wfcb_definitions, hcb_definitions;
 char              *sine=NULL;
+char              *schedule_db_name = NULL;
 pid_t              pid = 0;
 
 FunctionProperties free_symb_prop = FPIgnoreProps;
@@ -381,6 +382,7 @@ int main(int argc, char* argv[])
 
    pid = getpid();
    InitIO(NAME);
+   atexit(TempFileCleanup); /* Spill files */
 
    ESignalSetup(SIGXCPU);
 
@@ -407,11 +409,6 @@ int main(int argc, char* argv[])
    relevancy_pruned += ProofStateSinE(proofstate, sine);
    relevancy_pruned += ProofStatePreprocess(proofstate, relevance_prune_level);
 
-   if(strategy_scheduling)
-   {
-      ExecuteSchedule(StratSchedule, h_parms, print_rusage);
-   }
-
    FormulaSetDocInital(GlobalOut, OutputLevel, proofstate->f_axioms);
    ClauseSetDocInital(GlobalOut, OutputLevel, proofstate->axioms);
 
@@ -484,6 +481,32 @@ int main(int argc, char* argv[])
    }
    //printf("Alive (0.5)!\n");
    proofcontrol = ProofControlAlloc();
+   if(strategy_scheduling)
+   {
+      /* Clausification, preprocessing and problem classification
+         are the same for all strategies, so do them once and let the
+         children inherit the results. */
+      ProofControlComputeSpecs(proofcontrol, proofstate);
+      if(schedule_db_name)
+      {
+         PerfDB_p        perf_db = PerfDBAlloc(schedule_db_name);
+         SpecFeatureCell spec    = proofcontrol->problem_specs;
+         SpecLimits_p    limits  = CreateDefaultSpecLimits();
+         char            spec_class[SPEC_TYPE_LEN+1];
+
+         SpecFeaturesAddEval(&spec, limits);
+         SpecLimitsCellFree(limits);
+         SpecTypeString(spec_class, &spec, DEFAULT_CLASS_MASK);
+         ExecuteSchedule(StratSchedule, h_parms, print_rusage,
+                         perf_db, spec_class);
+         PerfDBFree(perf_db);
+      }
+      else
+      {
+         ExecuteSchedule(StratSchedule, h_parms, print_rusage,
+                         NULL, NULL);
+      }
+   }
    ProofControlInit(proofstate, proofcontrol, h_parms,
                     fvi_parms, wfcb_definitions, hcb_definitions);
    PCLFullTerms = pcl_full_terms; /* Preprocessing always uses full
@@ -757,6 +780,7 @@ cleanup1:
    PStackFree(wfcb_definitions);
    FVIndexParmsFree(fvi_parms);
    HeuristicParmsFree(h_parms);
+   LitFeaturesCacheFree();
 #ifdef FULL_MEM_STATS
    MemFreeListPrint(GlobalOut);
 #endif
@@ -1032,6 +1056,13 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_TSTP_PARSE:
             parse_format = TSTPFormat;
             break;
+      case OPT_INCLUDE_THREADS:
+            IncludePrefetchThreads =
+               CLStateGetIntArgCheckRange(handle, arg, 0, 1024);
+            break;
+      case OPT_INCLUDE_CACHE:
+            IncludeCacheDir = arg;
+            break;
       case OPT_TSTP_PRINT:
             DocOutputFormat = tstp_format;
             OutputFormat = TSTPFormat;
@@ -1068,6 +1099,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_SATAUTO_SCHED:
             strategy_scheduling = true;
             break;
+      case OPT_SCHEDULE_DB:
+            schedule_db_name = arg;
+            break;
       case OPT_NO_PREPROCESSING:
             no_preproc = true;
             break;
@@ -1186,6 +1220,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_DELETE_BAD_LIMIT:
             h_parms->delete_bad_limit = CLStateGetIntArg(handle, arg);
             break;
+      case OPT_SPILL_BAD_CLAUSES:
+            h_parms->spill_bad_clauses = true;
+            break;
       case OPT_ASSUME_COMPLETENESS:
             assume_inf_sys_complete = true;
             break;
@@ -1613,6 +1650,12 @@ CLState_p process_options(int argc, char* argv[])
    }
    SetMemoryLimit(h_parms->mem_limit);
 
+   if(schedule_db_name && !strategy_scheduling)
+   {
+      Warning("--schedule-db has no effect without --auto-schedule "
+              "or --satauto-schedule");
+   }
+
    return state;
 }
 
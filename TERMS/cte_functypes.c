@@ -259,6 +259,29 @@ static void normalize_float_rep(DStr_p float_rep)
 /----------------------------------------------------------------------*/
 
 FuncSymbType FuncSymbParse(Scanner_p in, DStr_p id)
+{
+   StrHashType hash;
+
+   return FuncSymbParseHashed(in, id, &hash);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FuncSymbParseHashed()
+//
+//   As FuncSymbParse(), but also store StrHash(DStrView(id)) in
+//   *hash. For the common case of a single token appended to an
+//   empty id this is the hash already computed by the scanner.
+//
+// Global Variables: SigIdentToken
+//
+// Side Effects    : Reads input, changes id
+//
+/----------------------------------------------------------------------*/
+
+FuncSymbType FuncSymbParseHashed(Scanner_p in, DStr_p id,
+                                 StrHashType *hash)
 {
    FuncSymbType res = FSNone;
    StrNumType numtype;
@@ -267,7 +290,16 @@ FuncSymbType FuncSymbParse(Scanner_p in, DStr_p id)
 
    if(TestInpTok(in, FuncSymbToken))
    {
-      DStrAppendStr(id, DStrView(AktToken(in)->literal));
+      if(DStrLen(id))
+      {
+         DStrAppendStr(id, DStrView(AktToken(in)->literal));
+         *hash = StrHash(DStrView(id));
+      }
+      else
+      {
+         DStrAppendStr(id, DStrView(AktToken(in)->literal));
+         *hash = AktToken(in)->hash;
+      }
 
       if(TestInpTok(in, Identifier))
       {
@@ -328,6 +360,7 @@ FuncSymbType FuncSymbParse(Scanner_p in, DStr_p id)
             assert(false);
             break;
       }
+      *hash = StrHash(DStrView(id));
    }
    return res;
 }
@@ -62,6 +62,8 @@ extern TokenType FuncSymbToken;
 extern TokenType FuncSymbStartToken;
 
 FuncSymbType FuncSymbParse(Scanner_p in, DStr_p id);
+FuncSymbType FuncSymbParseHashed(Scanner_p in, DStr_p id,
+                                 StrHashType *hash);
 
 
 #endif
@@ -66,6 +66,24 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: sig_name_compare()
+//
+//   Compare two symbols (given as pointers to Func_p) by name.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int sig_name_compare(const void* f1, const void* f2)
+{
+   return strcmp((*(const Func_p*)f1)->name, (*(const Func_p*)f2)->name);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: sig_compute_alpha_ranks()
@@ -80,22 +98,62 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
 
 static void sig_compute_alpha_ranks(Sig_p sig)
 {
-   PStack_p stack;
-   long count = 0;
-   StrTree_p handle;
-
-   stack = StrTreeTraverseInit(sig->f_index);
+   Func_p  *order;
+   FunCode i;
 
-   while((handle = StrTreeTraverseNext(stack)))
+   order = SizeMalloc(sizeof(Func_p)*sig->f_count);
+   for(i=1; i<=sig->f_count; i++)
+   {
+      order[i-1] = &(sig->f_info[i]);
+   }
+   qsort(order, sig->f_count, sizeof(Func_p), sig_name_compare);
+   for(i=0; i<sig->f_count; i++)
    {
-      sig->f_info[handle->val1.i_val].alpha_rank = count++;
+      order[i]->alpha_rank = i;
    }
-   StrTreeTraverseExit(stack);
+   SizeFree(order, sizeof(Func_p)*sig->f_count);
 
    sig->alpha_ranks_valid = true;
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: sig_index_grow()
+//
+//   Double the size of the f_index hash table and re-enter all
+//   symbols (using the stored hashes).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void sig_index_grow(Sig_p sig)
+{
+   long    mask, i;
+   FunCode f;
+
+   SizeFree(sig->f_index, sizeof(FunCode)*sig->index_size);
+   sig->index_size *= 2;
+   sig->f_index = SizeMalloc(sizeof(FunCode)*sig->index_size);
+   memset(sig->f_index, 0, sizeof(FunCode)*sig->index_size);
+
+   mask = sig->index_size-1;
+   for(f=1; f<=sig->f_count; f++)
+   {
+      for(i = sig->f_info[f].hash & mask;
+          sig->f_index[i];
+          i = (i+1) & mask)
+      {
+         /* Find free slot */
+      }
+      sig->f_index[i] = f;
+   }
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -124,7 +182,10 @@ Sig_p SigAlloc(SortTable_p sort_table)
    handle->f_count        = 0;
    handle->f_info         =
       SecureMalloc(sizeof(FuncCell)*DEFAULT_SIGNATURE_SIZE);
-   handle->f_index = NULL;
+   handle->index_size     = DEFAULT_SIG_INDEX_SIZE;
+   handle->f_index        =
+      SizeMalloc(sizeof(FunCode)*DEFAULT_SIG_INDEX_SIZE);
+   memset(handle->f_index, 0, sizeof(FunCode)*DEFAULT_SIG_INDEX_SIZE);
    handle->ac_axioms = PStackAlloc();
 
    handle->sort_table = sort_table;
@@ -247,13 +308,17 @@ void SigInsertInternalCodes(Sig_p sig)
 
 void SigFree(Sig_p junk)
 {
+   FunCode i;
+
    assert(junk);
    assert(junk->f_info);
 
-   /* names are shared with junk->f_index and are free()ed by the
-      StrTreeFree() call below! */
+   for(i=1; i<=junk->f_count; i++)
+   {
+      FREE(junk->f_info[i].name);
+   }
    FREE(junk->f_info);
-   StrTreeFree(junk->f_index);
+   SizeFree(junk->f_index, sizeof(FunCode)*junk->index_size);
    PStackFree(junk->ac_axioms);
    if(junk->orn_codes)
    {
@@ -280,13 +345,38 @@ void SigFree(Sig_p junk)
 
 FunCode SigFindFCode(Sig_p sig, const char* name)
 {
-   StrTree_p entry;
+   return SigFindFCodeHashed(sig, name, StrHash(name));
+}
 
-   entry = StrTreeFind(&(sig->f_index), name);
 
-   if(entry)
+/*-----------------------------------------------------------------------
+//
+// Function: SigFindFCodeHashed()
+//
+//   As SigFindFCode(), with hash == StrHash(name) already known
+//   (e.g. from the scanner).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+FunCode SigFindFCodeHashed(Sig_p sig, const char* name,
+                           StrHashType hash)
+{
+   long    mask = sig->index_size-1, i;
+   FunCode f;
+
+   assert(hash == StrHash(name));
+
+   for(i = hash & mask; (f = sig->f_index[i]); i = (i+1) & mask)
    {
-      return entry->val1.i_val;
+      if((sig->f_info[f].hash == hash) &&
+         (strcmp(sig->f_info[f].name, name) == 0))
+      {
+         return f;
+      }
    }
    return 0;
 }
@@ -564,10 +654,29 @@ void SigSetAllSpecial(Sig_p sig, bool value)
 
 FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
 {
-   long      pos;
-   StrTree_p new, test;
+   return SigInsertIdHashed(sig, name, StrHash(name), arity, special_id);
+}
 
-   pos = SigFindFCode(sig, name);
+
+/*-----------------------------------------------------------------------
+//
+// Function: SigInsertIdHashed()
+//
+//   As SigInsertId(), with hash == StrHash(name) already known.
+//
+// Global Variables: -
+//
+// Side Effects    : Potential memory operations.
+//
+/----------------------------------------------------------------------*/
+
+FunCode SigInsertIdHashed(Sig_p sig, const char* name,
+                          StrHashType hash, int arity,
+                          bool special_id)
+{
+   long pos, mask;
+
+   pos = SigFindFCodeHashed(sig, name, hash);
 
    if(pos) /* name is already known */
    {
@@ -599,12 +708,21 @@ FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
    sig->f_info[sig->f_count].properties = FPIgnoreProps;
    sig->f_info[sig->f_count].type = NULL;
    sig->f_info[sig->f_count].feature_offset = -1;
-   new = StrTreeCellAllocEmpty();
-   new->key = sig->f_info[sig->f_count].name;
-   new->val1.i_val = sig->f_count;
+   sig->f_info[sig->f_count].hash = hash;
 
-   test = StrTreeInsert(&(sig->f_index), new);
-   UNUSED(test); assert(test == NULL);
+   if(2*sig->f_count > sig->index_size)
+   {
+      sig_index_grow(sig); /* Also enters the new symbol */
+   }
+   else
+   {
+      mask = sig->index_size-1;
+      for(pos = hash & mask; sig->f_index[pos]; pos = (pos+1) & mask)
+      {
+         /* Find free slot */
+      }
+      sig->f_index[pos] = sig->f_count;
+   }
    SigSetSpecial(sig,sig->f_count,special_id);
    sig->alpha_ranks_valid = false;
 
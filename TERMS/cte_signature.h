@@ -80,13 +80,15 @@ typedef struct funccell
                              distinction. */
    Type_p type;       /* Simple type of the symbol */
    FunctionProperties properties;
+   StrHashType hash;  /* StrHash(name), kept for rehashing */
 }FuncCell, *Func_p;
 
 
 /* A signature contains information about function symbols with
    direct access by internal code (f_info is organized as a array,
    with f_info[f_code] being the information associated with f_code)
-   and efficient access by external name (via the f_index array).
+   and efficient access by external name (via the f_index hash
+   table).
 
    Function codes are integers starting at 1, while variables are
    encoded by negative integers. 0 is unused and can thus express
@@ -96,6 +98,12 @@ typedef struct funccell
 #define DEFAULT_SIGNATURE_SIZE 20
 #define DEFAULT_SIGNATURE_GROW 2
 
+/* f_index is an open addressing (linear probing) hash table of
+   f_codes, with 0 marking empty slots. Its size is a power of 2 and
+   it is kept at most half full. */
+
+#define DEFAULT_SIG_INDEX_SIZE 64
+
 typedef struct sigcell
 {
    bool      alpha_ranks_valid; /* The alpha-ranks are up to date */
@@ -103,7 +111,8 @@ typedef struct sigcell
    FunCode   f_count;  /* Largest used f_code */
    FunCode   internal_symbols; /* Largest auto-inserted internal symbol */
    Func_p    f_info;   /* The array */
-   StrTree_p f_index;  /* Back-assoc: Given a symbol, get the index */
+   FunCode   *f_index; /* Back-assoc: Given a symbol, get the index */
+   long      index_size; /* Size of f_index */
    PStack_p  ac_axioms; /* All recognized AC axioms */
    /* The following are special symbols needed for pattern
       manipulation. We want very efficient access to them! Also
@@ -197,6 +206,8 @@ void    SigFree(Sig_p junk);
 #define SigInterpreteNumbers(sig) ((sig)->null_code)
 
 FunCode SigFindFCode(Sig_p sig, const char* name);
+FunCode SigFindFCodeHashed(Sig_p sig, const char* name,
+                           StrHashType hash);
 static __inline__ int     SigFindArity(Sig_p sig, FunCode f_code);
 
 static __inline__ char*   SigFindName(Sig_p sig, FunCode f_code);
@@ -220,6 +231,9 @@ int     SigGetAlphaRank(Sig_p sig, FunCode f_code);
 
 FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool
           special_id);
+FunCode SigInsertIdHashed(Sig_p sig, const char* name,
+                          StrHashType hash, int arity,
+                          bool special_id);
 FunCode SigInsertFOFOp(Sig_p sig, const char* name, int arity);
 void    SigPrint(FILE* out, Sig_p sig);
 void    SigPrintSpecial(FILE* out, Sig_p sig);
@@ -1016,6 +1016,7 @@ Term_p TBTermParseReal(Scanner_p in, TB_p bank, bool check_symb_prop)
    SortType      sort;
    long          line, column;
    StreamType    type;
+   StrHashType   hash;
 
    source_name = DStrGetRef(AktToken(in)->source);
    type        = AktToken(in)->stream_type;
@@ -1089,7 +1090,7 @@ Term_p TBTermParseReal(Scanner_p in, TB_p bank, bool check_symb_prop)
       {
          id = DStrAlloc();
 
-         if((id_type=TermParseOperator(in, id))==FSIdentVar)
+         if((id_type=TermParseOperatorHashed(in, id, &hash))==FSIdentVar)
          {
             /* A variable may be annotated with a sort */
             if(TestInpTok(in, Colon))
@@ -1150,8 +1151,9 @@ Term_p TBTermParseReal(Scanner_p in, TB_p bank, bool check_symb_prop)
             {
                handle->arity = 0;
             }
-            handle->f_code = TermSigInsert(bank->sig, DStrView(id),
-                                           handle->arity, false, id_type);
+            handle->f_code = TermSigInsertHashed(bank->sig, DStrView(id),
+                                                 hash, handle->arity,
+                                                 false, id_type);
             if(!handle->f_code)
             {
                errpos = DStrAlloc();
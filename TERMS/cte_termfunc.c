@@ -199,7 +199,8 @@ void VarPrint(FILE* out, FunCode var)
    {
       id = 'Y';
    }
-   fprintf(out, "%c%ld", id, -((var-1)/2));
+   OutPutc(id, out);
+   OutPrintLong(out, -((var-1)/2));
 }
 
 
@@ -253,7 +254,7 @@ void TermPrint(FILE* out, Term_p term, Sig_p sig, DerefType deref)
       }
       else
       {
-         fputs(SigFindName(sig, term->f_code), out);
+         OutPuts(out, SigFindName(sig, term->f_code));
          if(!TermIsConst(term))
          {
             assert(term->args);
@@ -264,7 +265,7 @@ void TermPrint(FILE* out, Term_p term, Sig_p sig, DerefType deref)
 
    if(TermPrintTypes)
    {
-      fputc(':', out);
+      OutPutc(':', out);
       SortPrintTSTP(out, sig->sort_table, term->sort);
    }
 }
@@ -289,17 +290,17 @@ void TermPrintArgList(FILE* out, Term_p *args, int arity, Sig_p sig,
    int i;
 
    assert(arity>=1);
-   putc('(', out);
+   OutPutc('(', out);
 
    TermPrint(out, args[0], sig, deref);
 
    for(i=1; i<arity; i++)
    {
-      putc(',', out);
+      OutPutc(',', out);
       /* putc(' ', out); */
       TermPrint(out, args[i], sig, deref);
    }
-   putc(')', out);
+   OutPutc(')', out);
 }
 
 
@@ -329,7 +330,29 @@ void TermPrintArgList(FILE* out, Term_p *args, int arity, Sig_p sig,
 
 FuncSymbType TermParseOperator(Scanner_p in, DStr_p id)
 {
-   FuncSymbType res = FuncSymbParse(in, id);
+   StrHashType hash;
+
+   return TermParseOperatorHashed(in, id, &hash);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermParseOperatorHashed()
+//
+//   As TermParseOperator(), but also return the hash of id (see
+//   FuncSymbParseHashed()) in *hash.
+//
+// Global Variables: SigIdentStartToken
+//
+// Side Effects    : Read input
+//
+/----------------------------------------------------------------------*/
+
+FuncSymbType TermParseOperatorHashed(Scanner_p in, DStr_p id,
+                                     StrHashType *hash)
+{
+   FuncSymbType res = FuncSymbParseHashed(in, id, hash);
 
 #ifndef STRICT_TPTP
    if((isupper(DStrView(id)[0])
@@ -360,10 +383,31 @@ FuncSymbType TermParseOperator(Scanner_p in, DStr_p id)
 
 FunCode TermSigInsert(Sig_p sig, const char* name, int arity, bool
                       special_id, FuncSymbType type)
+{
+   return TermSigInsertHashed(sig, name, StrHash(name), arity,
+                              special_id, type);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermSigInsertHashed()
+//
+//   As TermSigInsert(), with hash == StrHash(name) already known.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+FunCode TermSigInsertHashed(Sig_p sig, const char* name,
+                            StrHashType hash, int arity,
+                            bool special_id, FuncSymbType type)
 {
    FunCode res;
 
-   res = SigInsertId(sig, name, arity, special_id);
+   res = SigInsertIdHashed(sig, name, hash, arity, special_id);
    switch(type)
    {
    case FSIdentInt:
@@ -411,6 +455,7 @@ Term_p TermParse(Scanner_p in, Sig_p sig, VarBank_p vars)
    SortType      sort;
    long          line, column;
    StreamType    type;
+   StrHashType   hash;
 
    if(SigSupportLists && TestInpTok(in, OpenSquare))
    {
@@ -424,7 +469,7 @@ Term_p TermParse(Scanner_p in, Sig_p sig, VarBank_p vars)
       source_name = DStrGetRef(AktToken(in)->source);
       type = AktToken(in)->stream_type;
 
-      if((id_type = TermParseOperator(in, id))==FSIdentVar)
+      if((id_type = TermParseOperatorHashed(in, id, &hash))==FSIdentVar)
       {
          /* A variable may be annotated with a sort */
          if(TestInpTok(in, Colon))
@@ -467,8 +512,9 @@ Term_p TermParse(Scanner_p in, Sig_p sig, VarBank_p vars)
          {
             handle->arity = 0;
          }
-         handle->f_code = TermSigInsert(sig, DStrView(id),
-                                        handle->arity, false, id_type);
+         handle->f_code = TermSigInsertHashed(sig, DStrView(id), hash,
+                                              handle->arity, false,
+                                              id_type);
          if(!handle->f_code)
          {
             errpos = DStrAlloc();